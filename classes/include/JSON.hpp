@@ -31,6 +31,7 @@ class IParser;
 class ISource;
 class IDestination;
 class IAction;
+class IEvents;
 class JSON_Impl;
 struct String;
 class Default_Parser;
@@ -79,6 +80,11 @@ public:
   void parse(ISource &&source);
   JSON_LIB_NODISCARD Result<Node> parseResult(ISource &source);
   JSON_LIB_NODISCARD Result<Node> parseResult(ISource &&source);
+  // Parse JSON raising events as it is read instead of building the tree
+  void parse(ISource &source, IEvents &events);
+  void parse(ISource &&source, IEvents &events);
+  JSON_LIB_NODISCARD Result<void> parseResult(ISource &source, IEvents &events);
+  JSON_LIB_NODISCARD Result<void> parseResult(ISource &&source, IEvents &events);
   // Create JSON text string from Node tree (no whitespace)
   void stringify(IDestination &destination) const;
   void stringify(IDestination &&destination) const;
@@ -89,11 +95,11 @@ public:
   void print(IDestination &&destination) const;
   JSON_LIB_NODISCARD Result<void> printResult(IDestination &destination) const;
   JSON_LIB_NODISCARD Result<void> printResult(IDestination &&destination) const;
-  // Strip whitespace from JSON string
-  static void strip(ISource &source, IDestination &destination);
-  static void strip(ISource &source, IDestination &&destination) ;
-  static void strip(ISource &&source, IDestination &destination) ;
-  static void strip(ISource &&source, IDestination &&destination) ;
+  // Strip whitespace from JSON string (validate == true then check it is well-formed first)
+  static void strip(ISource &source, IDestination &destination, bool validate = false);
+  static void strip(ISource &source, IDestination &&destination, bool validate = false);
+  static void strip(ISource &&source, IDestination &destination, bool validate = false);
+  static void strip(ISource &&source, IDestination &&destination, bool validate = false);
   // Traverse JSON tree
   void traverse(IAction &action);
   void traverse(IAction &action) const;
@@ -101,9 +107,18 @@ public:
   JSON_LIB_NODISCARD Result<void> traverseResult(IAction &action) const;
   // Set print ident value
   void setIndent(long indent);
+  // Set/get print indent character (space or tab)
+  void setIndentCharacter(char indentCharacter);
+  JSON_LIB_NODISCARD char getIndentCharacter() const noexcept;
   // Set/get maximum parser recursion depth
   void setMaxParserDepth(unsigned long depth);
   JSON_LIB_NODISCARD unsigned long getMaxParserDepth() const noexcept;
+  // Set/get arena mode: parsed trees are allocated from one region freed in bulk on re-parse/destruction
+  void setArenaMode(bool enabled);
+  JSON_LIB_NODISCARD bool getArenaMode() const noexcept;
+  // Set/get borrowed strings: strings/keys parsed from contiguous sources reference the source bytes
+  void setBorrowedStrings(bool borrow);
+  JSON_LIB_NODISCARD bool getBorrowedStrings() const noexcept;
   // Get the root of JSON tree
   /// @brief Returns a mutable reference to the root node (modifies tree).
   JSON_LIB_NODISCARD Node &root();
@@ -11,6 +11,8 @@ constexpr char kStringSingleQuote = '\'';
 constexpr char kEscape = '\\';
 constexpr char kColon = ':';
 constexpr char kComma = ',';
+constexpr char kSpace = ' ';
+constexpr char kTab = '\t';
 constexpr char kPlus = '+';
 constexpr char kMinus = '-';
 constexpr char kZero = '0';
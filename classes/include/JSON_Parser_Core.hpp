@@ -7,4 +7,8 @@
 #include "JSON_IO_Core.hpp"
 #include "Default_Translator.hpp"
 #include "Default_Parser.hpp"
+#include "Structural_Parser.hpp"
+#include "JSON_Reader.hpp"
+#include "Incremental_Parser.hpp"
+#include "JSON_Lines.hpp"
 #include "Default_Stringify.hpp"
@@ -2,6 +2,7 @@
 #include "JSON_Throw.hpp"
 
 #include <memory>
+#include <memory_resource>
 #include "JSON.hpp"
 #include "JSON_Parser_Core.hpp"
 
@@ -16,22 +17,29 @@ public:
   JSON_Impl &operator=(const JSON_Impl &other) = delete;
   JSON_Impl(JSON_Impl &&other) = delete;
   JSON_Impl &operator=(JSON_Impl &&other) = delete;
-  ~JSON_Impl() = default;
+  ~JSON_Impl() { releaseTree(); }
   // Get JSON_Lib version
   static std::string version();
   // Parse JSON into Node tree
   void parse(ISource &source);
   Result<Node> parseResult(ISource &source);
+  // Parse JSON raising events instead of building a tree
+  void parse(ISource &source, IEvents &events);
+  Result<void> parseResult(ISource &source, IEvents &events);
   // Create JSON text string (no white space) from Node tree
   void stringify(IDestination &destination) const;
   Result<void> stringifyResult(IDestination &destination) const;
   // Create JSON structured text string (pretty print) from Node tree
   void print(IDestination &destination) const;
   Result<void> printResult(IDestination &destination) const;
-  // Strip whitespace from JSON string
-  static void strip(ISource &source, IDestination &destination);
+  // Strip whitespace from JSON string (optionally checking it is well-formed first)
+  static void strip(ISource &source, IDestination &destination, bool validate);
   // Get the root of JSON tree
-  JSON_LIB_NODISCARD Node &root() JSON_LIB_NOEXCEPT { return jNodeRoot; }
+  JSON_LIB_NODISCARD Node &root() JSON_LIB_NOEXCEPT
+  {
+    bulkRelease = false;
+    return jNodeRoot;
+  }
   JSON_LIB_NODISCARD const Node &root() const JSON_LIB_NOEXCEPT { return jNodeRoot; }
   // Search for JSON object entry with a given key
   Node &operator[](const std::string_view &key);
@@ -48,9 +56,18 @@ public:
   Result<void> runTraverse(IAction &action) const;
   // Set print ident value
   void setIndent(const long indent);
+  // Set/get print indent character
+  void setIndentCharacter(const char indentCharacter) { jsonStringify->setIndentCharacter(indentCharacter); }
+  JSON_LIB_NODISCARD char getIndentCharacter() const noexcept { return jsonStringify->getIndentCharacter(); }
   // Set/get maximum parser recursion depth
   void setMaxParserDepth(unsigned long depth);
   JSON_LIB_NODISCARD unsigned long getMaxParserDepth() const noexcept;
+  // Set/get arena allocation of parsed trees
+  void setArenaMode(const bool enabled) noexcept { arenaMode = enabled; }
+  JSON_LIB_NODISCARD bool getArenaMode() const noexcept { return arenaMode; }
+  // Set/get whether parsed strings reference the source bytes
+  void setBorrowedStrings(bool borrow);
+  JSON_LIB_NODISCARD bool getBorrowedStrings() const noexcept;
 #if !JSON_LIB_NO_STDIO
   // Read/Write JSON from a file
   static std::string fromFile(const std::string_view &fileName);
@@ -64,6 +81,20 @@ private:
   Result<void> runStringify(IDestination &destination, unsigned long indent) const;
   // Traverse JSON tree
   template<typename T> static void traverseNodes(T &jNode, IAction &action);
+  // Create arena for a parse of the given source
+  static std::unique_ptr<std::pmr::monotonic_buffer_resource> makeArena(ISource &source);
+  // Release current tree / replace it with a newly parsed one
+  void releaseTree() noexcept;
+  void adoptTree(Node &&parsed,
+    std::unique_ptr<std::pmr::monotonic_buffer_resource> &&arena,
+    std::shared_ptr<const void> &&input) noexcept;
+  // Arena mode flag and arena holding the current tree (declared before the root so that it outlives it)
+  bool arenaMode{ false };
+  std::unique_ptr<std::pmr::monotonic_buffer_resource> jsonArena;
+  // Set while the tree is entirely arena allocated and so can be released without destructors
+  bool bulkRelease{ false };
+  // Source bytes that borrowed strings in the current tree reference (when the source could share them)
+  std::shared_ptr<const void> jsonInput;
   // Root of JSON tree
   Node jNodeRoot;
   // Parser/stringifier/translator instances for this JSON object.
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <memory_resource>
+
+namespace JSON_Lib {
+namespace detail {
+
+// ==================================================================
+// Memory resource that Node storage (objects, arrays, their entry
+// lists, keys and strings) is allocated from on the calling thread.
+// Defaults to the std::pmr default resource (normally the heap);
+// JSON_Impl points it at a document arena for the duration of a
+// parse when arena mode is enabled.
+// Containers remember the resource they were created with, so nodes
+// built outside of an arena can still be mixed into an arena tree.
+// ==================================================================
+inline std::pmr::memory_resource *&currentNodeResource() noexcept
+{
+  thread_local std::pmr::memory_resource *resource = nullptr;
+  return resource;
+}
+inline std::pmr::memory_resource *nodeResource() noexcept
+{
+  auto *resource = currentNodeResource();
+  return resource != nullptr ? resource : std::pmr::get_default_resource();
+}
+
+// Route Node storage allocations on this thread to a resource for the lifetime of the scope
+class ScopedNodeResource
+{
+public:
+  explicit ScopedNodeResource(std::pmr::memory_resource *resource) noexcept : previous(currentNodeResource())
+  {
+    currentNodeResource() = resource;
+  }
+  ScopedNodeResource(const ScopedNodeResource &other) = delete;
+  ScopedNodeResource &operator=(const ScopedNodeResource &other) = delete;
+  ScopedNodeResource(ScopedNodeResource &&other) = delete;
+  ScopedNodeResource &operator=(ScopedNodeResource &&other) = delete;
+  ~ScopedNodeResource() { currentNodeResource() = previous; }
+
+private:
+  std::pmr::memory_resource *previous;
+};
+
+// Deleter for heap nodes (Object/Array) returning them to the resource they came from
+template<typename T> struct NodeDelete
+{
+  void operator()(T *value) const noexcept
+  {
+    std::pmr::polymorphic_allocator<T> allocator{ value->resource() };
+    allocator.delete_object(value);
+  }
+};
+
+}// namespace detail
+}// namespace JSON_Lib
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <utility>
 #include "JSON_ErrorBase.hpp"
 
@@ -19,12 +20,66 @@ enum class Status : uint8_t
   UnknownError
 };
 
+// JSON error types
+inline std::string formatPosition(const std::pair<long, long> &position, const std::string_view prefix)
+{
+  const auto line = std::to_string(position.first);
+  const auto col  = std::to_string(position.second);
+  std::string s;
+  s.reserve(prefix.size() + 12 + line.size() + col.size()); // " [Line:  Column: ]: " ~ 12
+  s.append(prefix).append(" [Line: ").append(line)
+   .append(" Column: ").append(col).append("]: ");
+  return s;
+}
+
+// ==================================================================
+// Error message of a Result. Errors the library reports itself are
+// held as their parts (a tag such as "JSON Syntax", a static detail
+// string and an optional line/column) and only formatted into text
+// when the message is read, so a failed parse builds no string until
+// it is needed.
+// ==================================================================
+class ErrorMessage
+{
+public:
+  ErrorMessage() = default;
+  ErrorMessage(std::string text) : m_text(std::move(text)) {}
+  ErrorMessage(const char *text) : m_text(text) {}
+  // Message "<tag> Error: <detail>" or "<tag> Error [Line: L Column: C]: <detail>"
+  // (detail must outlive the message, e.g. a string literal)
+  ErrorMessage(const std::string_view tag, const std::string_view detail,
+    const std::optional<std::pair<long, long>> &position = std::nullopt)
+    : m_tag(tag), m_detail(detail), m_position(position)
+  {}
+  // Formatted message text
+  JSON_LIB_NODISCARD std::string str() const
+  {
+    if (m_tag.empty()) { return m_text; }
+    if (!m_position) { return makeTaggedError(m_tag, m_detail); }
+    return formatPosition(*m_position, std::string(m_tag).append(" Error")).append(m_detail);
+  }
+  operator std::string() const { return str(); }
+  JSON_LIB_NODISCARD bool empty() const noexcept { return m_tag.empty() && m_text.empty(); }
+  friend bool operator==(const ErrorMessage &lhs, const std::string_view rhs) { return lhs.str() == rhs; }
+  template<typename Stream>
+  friend auto operator<<(Stream &stream, const ErrorMessage &message) -> decltype(stream << std::string{})
+  {
+    return stream << message.str();
+  }
+
+private:
+  std::string m_text;
+  std::string_view m_tag;
+  std::string_view m_detail;
+  std::optional<std::pair<long, long>> m_position;
+};
+
 template<typename T>
 struct [[nodiscard]] Result
 {
   Status status{Status::Ok};
-  std::unique_ptr<T> value;
-  std::string message;
+  std::optional<T> value;
+  ErrorMessage message;
   std::pair<long, long> position{0, 0};
 
   JSON_LIB_NODISCARD bool ok() const JSON_LIB_NOEXCEPT { return status == Status::Ok; }
@@ -36,23 +91,12 @@ template<>
 struct [[nodiscard]] Result<void>
 {
   Status status{Status::Ok};
-  std::string message;
+  ErrorMessage message;
   std::pair<long, long> position{0, 0};
 
   JSON_LIB_NODISCARD bool ok() const JSON_LIB_NOEXCEPT { return status == Status::Ok; }
 };
 
-// JSON error types
-inline std::string formatPosition(const std::pair<long, long> &position, const std::string_view prefix)
-{
-  const auto line = std::to_string(position.first);
-  const auto col  = std::to_string(position.second);
-  std::string s;
-  s.reserve(prefix.size() + 12 + line.size() + col.size()); // " [Line:  Column: ]: " ~ 12
-  s.append(prefix).append(" [Line: ").append(line)
-   .append(" Column: ").append(col).append("]: ");
-  return s;
-}
 struct Error final : std::runtime_error
 {
   explicit Error(const std::string_view &message) : std::runtime_error(makeTaggedError("JSON", message)) {}
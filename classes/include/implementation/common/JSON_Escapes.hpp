@@ -0,0 +1,71 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include "ITranslator.hpp"
+#include "JSON_Char_Constants.hpp"
+
+namespace JSON_Lib {
+
+// ==================================================================
+// Check whether character is a valid-escaped character or is just
+// normally escaped ASCII character. Only a few characters are valid
+// escaped characters such as '\t' or '\"' but normal ASCII characters
+// may still have a '\' prefix and be escaped though not in the proper
+// escaped sense.
+// ==================================================================
+inline bool validEscape(const char escape) noexcept
+{
+  return escape == kEscape || escape == 't' || escape == kStringQuote || escape == 'b' || escape == 'f'
+         || escape == 'n' || escape == 'r' || escape == 'u';
+}
+
+// ==================================================================
+// Body of a JSON string exactly as it appears between its quotes,
+// with the '\' of escapes that are not valid JSON escapes dropped
+// (keeping the character), ready for the translator. When there is
+// no '\' to drop the body itself is returned without being copied.
+// ==================================================================
+inline std::string_view dropInvalidEscapes(const std::string_view &raw, std::string &buffer)
+{
+  auto escape = raw.find(kEscape);
+  while (escape != std::string_view::npos && escape + 1 < raw.size() && validEscape(raw[escape + 1])) {
+    escape = raw.find(kEscape, escape + 2);
+  }
+  if (escape == std::string_view::npos || escape + 1 == raw.size()) { return raw; }
+  buffer.clear();
+  buffer.reserve(raw.size());
+  for (std::size_t next = 0; next < raw.size(); next++) {
+    if (raw[next] == kEscape && next + 1 < raw.size()) {
+      if (validEscape(raw[next + 1])) { buffer += kEscape; }
+      next++;
+    }
+    buffer += raw[next];
+  }
+  return buffer;
+}
+
+// ==================================================================
+// Decode the body of a JSON string; the translator throws on any
+// malformed escape sequence.
+// ==================================================================
+inline std::string unescapeString(const std::string_view &raw, const ITranslator &translator)
+{
+  std::string buffer;
+  return translator.from(dropInvalidEscapes(raw, buffer));
+}
+
+// ==================================================================
+// Decode the body of a JSON string, reporting rather than throwing
+// a malformed escape sequence (see ITranslator::tryFrom()).
+// ==================================================================
+inline bool tryUnescapeString(const std::string_view &raw,
+  const ITranslator &translator,
+  std::string &unescaped,
+  const char *&message)
+{
+  std::string buffer;
+  return translator.tryFrom(dropInvalidEscapes(raw, buffer), unescaped, message);
+}
+
+}// namespace JSON_Lib
@@ -0,0 +1,126 @@
+#pragma once
+
+#include "JSON_Config.hpp"
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <string_view>
+
+namespace JSON_Lib {
+namespace detail {
+
+// ==================================================================
+// Hash of object keys (wyhash). It is seeded at random once per
+// process so that keys crafted to collide on one run do not collide
+// on another, which keeps object indexing linear under hostile input.
+// ==================================================================
+
+#if defined(__SIZEOF_INT128__)
+__extension__ using KeyHashWide = unsigned __int128;
+#endif
+
+// wyhash constants
+constexpr std::uint64_t kKeyHashPrime0{ 0xa0761d6478bd642full };
+constexpr std::uint64_t kKeyHashPrime1{ 0xe7037ed1a0b428dbull };
+constexpr std::uint64_t kKeyHashPrime2{ 0x8ebc6af09c88c6e3ull };
+constexpr std::uint64_t kKeyHashPrime3{ 0x589965cc75374cc3ull };
+
+// Full 64 x 64 -> 128 bit multiply, low half returned in lhs and high half in rhs
+inline void keyHashMultiply(std::uint64_t &lhs, std::uint64_t &rhs) noexcept
+{
+#if defined(__SIZEOF_INT128__)
+  const auto product = static_cast<KeyHashWide>(lhs) * rhs;
+  lhs = static_cast<std::uint64_t>(product);
+  rhs = static_cast<std::uint64_t>(product >> 64);
+#else
+  const std::uint64_t lhsHigh = lhs >> 32, lhsLow = static_cast<std::uint32_t>(lhs);
+  const std::uint64_t rhsHigh = rhs >> 32, rhsLow = static_cast<std::uint32_t>(rhs);
+  const std::uint64_t high = lhsHigh * rhsHigh, middle0 = lhsHigh * rhsLow, middle1 = lhsLow * rhsHigh;
+  const std::uint64_t low = lhsLow * rhsLow;
+  const std::uint64_t middle = (low >> 32) + static_cast<std::uint32_t>(middle0) + static_cast<std::uint32_t>(middle1);
+  lhs = (middle << 32) | static_cast<std::uint32_t>(low);
+  rhs = high + (middle0 >> 32) + (middle1 >> 32) + (middle >> 32);
+#endif
+}
+inline std::uint64_t keyHashMix(std::uint64_t lhs, std::uint64_t rhs) noexcept
+{
+  keyHashMultiply(lhs, rhs);
+  return lhs ^ rhs;
+}
+inline std::uint64_t keyHashRead64(const unsigned char *bytes) noexcept
+{
+  std::uint64_t value;
+  std::memcpy(&value, bytes, sizeof(value));
+  return value;
+}
+inline std::uint64_t keyHashRead32(const unsigned char *bytes) noexcept
+{
+  std::uint32_t value;
+  std::memcpy(&value, bytes, sizeof(value));
+  return value;
+}
+
+// Hash key with a given seed
+JSON_LIB_NODISCARD inline std::uint64_t keyHash(const std::string_view &key, std::uint64_t seed) noexcept
+{
+  const auto *bytes = reinterpret_cast<const unsigned char *>(key.data());
+  const std::size_t length = key.size();
+  seed ^= keyHashMix(seed ^ kKeyHashPrime0, kKeyHashPrime1);
+  std::uint64_t lhs{};
+  std::uint64_t rhs{};
+  if (length <= 16) {
+    if (length >= 4) {
+      const std::size_t offset = (length >> 3) << 2;
+      lhs = keyHashRead32(bytes) << 32 | keyHashRead32(bytes + offset);
+      rhs = keyHashRead32(bytes + length - 4) << 32 | keyHashRead32(bytes + length - 4 - offset);
+    } else if (length > 0) {
+      lhs = std::uint64_t{ bytes[0] } << 16 | std::uint64_t{ bytes[length >> 1] } << 8 | bytes[length - 1];
+    }
+  } else {
+    std::size_t remaining = length;
+    if (remaining > 48) {
+      std::uint64_t seed1 = seed;
+      std::uint64_t seed2 = seed;
+      do {
+        seed = keyHashMix(keyHashRead64(bytes) ^ kKeyHashPrime1, keyHashRead64(bytes + 8) ^ seed);
+        seed1 = keyHashMix(keyHashRead64(bytes + 16) ^ kKeyHashPrime2, keyHashRead64(bytes + 24) ^ seed1);
+        seed2 = keyHashMix(keyHashRead64(bytes + 32) ^ kKeyHashPrime3, keyHashRead64(bytes + 40) ^ seed2);
+        bytes += 48;
+        remaining -= 48;
+      } while (remaining > 48);
+      seed ^= seed1 ^ seed2;
+    }
+    while (remaining > 16) {
+      seed = keyHashMix(keyHashRead64(bytes) ^ kKeyHashPrime1, keyHashRead64(bytes + 8) ^ seed);
+      bytes += 16;
+      remaining -= 16;
+    }
+    lhs = keyHashRead64(bytes + remaining - 16);
+    rhs = keyHashRead64(bytes + remaining - 8);
+  }
+  lhs ^= kKeyHashPrime1;
+  rhs ^= seed;
+  keyHashMultiply(lhs, rhs);
+  return keyHashMix(lhs ^ kKeyHashPrime0 ^ length, rhs ^ kKeyHashPrime1);
+}
+
+// Random seed chosen the first time it is asked for
+JSON_LIB_NODISCARD inline std::uint64_t keyHashSeed() noexcept
+{
+  static const std::uint64_t seed = [] {
+    std::random_device device;
+    const auto ticks = static_cast<std::uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+    return keyHashMix((std::uint64_t{ device() } << 32 | device()) ^ kKeyHashPrime2, ticks ^ kKeyHashPrime3);
+  }();
+  return seed;
+}
+
+// Hash of an object key with the process seed
+JSON_LIB_NODISCARD inline std::size_t hashKey(const std::string_view &key) noexcept
+{
+  return static_cast<std::size_t>(keyHash(key, keyHashSeed()));
+}
+
+}// namespace detail
+}// namespace JSON_Lib
@@ -1,45 +1,132 @@
 #pragma once
 
 #include "JSON_Config.hpp"
-#include <string>
+#include "JSON_KeyHash.hpp"
+#include "JSON_Throw.hpp"
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <limits>
+#include <memory_resource>
+#include <stdexcept>
 #include <string_view>
-#include <unordered_map>
 #include <vector>
 
 namespace JSON_Lib {
 namespace detail {
 
+// Objects with up to this many entries are searched by a linear scan and have no index
+#if JSON_LIB_EMBEDDED
+constexpr std::size_t kObjectLinearScanEntries{ 4 };
+#else
+constexpr std::size_t kObjectLinearScanEntries{ 8 };
+#endif
+
 #if !JSON_LIB_EMBEDDED
 
-/// @brief Transparent hash for string keys allowing string_view lookup.
-struct StringHash
+/// @brief Open-addressing object index (desktop build) from key hash to entry position; the
+/// keys themselves are only held by the object's entries. Each slot is a 32-bit hash and
+/// entry position, probed linearly and kept at most half full.
+class ObjectIndex
 {
-  using is_transparent = void;
-  JSON_LIB_NODISCARD std::size_t operator()(std::string_view value) const noexcept
+public:
+  static constexpr std::size_t npos = std::numeric_limits<std::size_t>::max();
+  /// @brief Outcome of probing for a key: the position found (npos if none) and the free slot
+  /// that a new position for the key goes in.
+  struct Probe
   {
-    return std::hash<std::string_view>{}(value);
+    std::size_t position;
+    std::size_t slot;
+    std::uint32_t hash;
+  };
+
+  explicit ObjectIndex(std::pmr::memory_resource *resource) : m_slots(resource) {}
+  /// @brief Have no positions been indexed.
+  JSON_LIB_NODISCARD bool empty() const noexcept { return m_count == 0; }
+  /// @brief Make room for count positions.
+  void reserve(const std::size_t count)
+  {
+    if (count * 2 > m_slots.size()) { rehash(count * 2); }
   }
-  JSON_LIB_NODISCARD std::size_t operator()(const std::string &value) const noexcept
+  /// @brief Position indexed under a key hash that match accepts (npos if none).
+  template<typename Match> JSON_LIB_NODISCARD std::size_t find(const std::size_t hash, Match &&match) const
   {
-    return std::hash<std::string_view>{}(value);
+    if (m_slots.empty()) { return npos; }
+    return walk(fold(hash), match).position;
+  }
+  /// @brief Probe for a key hash once, making sure there is room to index a new position after.
+  template<typename Match> JSON_LIB_NODISCARD Probe probe(const std::size_t hash, Match &&match)
+  {
+    reserve(m_count + 1);
+    return walk(fold(hash), match);
+  }
+  /// @brief Index a position in the slot found by the last probe (nothing indexed in between).
+  void insert(const Probe &probe, const std::size_t position)
+  {
+    m_slots[probe.slot] = Slot{ probe.hash, checkedPosition(position) };
+    m_count++;
+  }
+  /// @brief Index a position under a key hash.
+  void insert(const std::size_t hash, const std::size_t position)
+  {
+    reserve(m_count + 1);
+    place(Slot{ fold(hash), checkedPosition(position) });
+    m_count++;
   }
-};
 
-/// @brief Transparent equality comparator for string keys.
-struct StringEqual
-{
-  using is_transparent = void;
-  JSON_LIB_NODISCARD bool operator()(std::string_view lhs, std::string_view rhs) const noexcept { return lhs == rhs; }
-  JSON_LIB_NODISCARD bool operator()(const std::string &lhs, const std::string &rhs) const noexcept { return lhs == rhs; }
-};
+private:
+  // Empty slots have a position of zero; others hold the entry position plus one
+  struct Slot
+  {
+    std::uint32_t hash;
+    std::uint32_t position;
+  };
+  template<typename Match> Probe walk(const std::uint32_t tag, Match &match) const
+  {
+    const auto mask = m_slots.size() - 1;
+    for (auto slot = tag & mask;; slot = (slot + 1) & mask) {
+      if (m_slots[slot].position == 0) { return Probe{ npos, slot, tag }; }
+      if (m_slots[slot].hash == tag && match(m_slots[slot].position - 1)) {
+        return Probe{ m_slots[slot].position - 1, slot, tag };
+      }
+    }
+  }
+  static std::uint32_t checkedPosition(const std::size_t position)
+  {
+    if (position >= std::numeric_limits<std::uint32_t>::max()) {
+      JSON_THROW(std::length_error("Object index position out of range."));
+    }
+    return static_cast<std::uint32_t>(position + 1);
+  }
+  static std::uint32_t fold(const std::size_t hash) noexcept
+  {
+    return static_cast<std::uint32_t>(static_cast<std::uint64_t>(hash) ^ static_cast<std::uint64_t>(hash) >> 32);
+  }
+  void place(const Slot &entry) noexcept
+  {
+    const auto mask = m_slots.size() - 1;
+    auto slot = entry.hash & mask;
+    while (m_slots[slot].position != 0) { slot = (slot + 1) & mask; }
+    m_slots[slot] = entry;
+  }
+  void rehash(const std::size_t capacity)
+  {
+    std::pmr::vector<Slot> slots(std::max(kMinimumSlots, std::bit_ceil(capacity)), Slot{}, m_slots.get_allocator());
+    slots.swap(m_slots);
+    for (const auto &entry : slots) {
+      if (entry.position != 0) { place(entry); }
+    }
+  }
 
-/// @brief Hash-map object index (desktop build).
-using ObjectIndex = std::unordered_map<std::string, std::size_t, StringHash, StringEqual>;
+  static constexpr std::size_t kMinimumSlots{ 32 };
+  std::pmr::vector<Slot> m_slots;
+  std::size_t m_count{};
+};
 
 #else
 
 /// @brief Sorted-vector object index (embedded build).
-using ObjectIndex = std::vector<std::size_t>;
+using ObjectIndex = std::pmr::vector<std::size_t>;
 
 #endif
 
@@ -1,27 +1,95 @@
 #pragma once
 
+#include <algorithm>
+#include <string>
+#include <string_view>
+
 #include "IDestination.hpp"
 #include "ITranslator.hpp"
+#include "JSON_Number.hpp"
 
 namespace JSON_Lib {
 
-/// @brief Append `count` space characters to destination.
-inline void addIndent(IDestination &destination, const unsigned long count)
+// Helpers are templated on the destination so that stringifiers can write
+// through a StringifyBuffer without a virtual call per token; any
+// IDestination works as well.
+
+// Blocks of indent characters that addIndent() writes from
+inline constexpr std::string_view kIndentSpaces{ "                                                                " };
+inline constexpr std::string_view kIndentTabs{
+  "\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t"
+};
+
+/// @brief Append `count` indent characters (spaces or tabs) to destination, written from a static block.
+template<typename Destination>
+void addIndent(Destination &destination, unsigned long count, const char indentCharacter = ' ')
 {
-  if (count > 0) { destination.add(std::string(count, ' ')); }
+  const std::string_view block{ indentCharacter == '\t' ? kIndentTabs : kIndentSpaces };
+  while (count > 0) {
+    const auto length = std::min(count, static_cast<unsigned long>(block.size()));
+    destination.add(block.substr(0, length));
+    count -= length;
+  }
 }
 
+// ==============================================================
+// Newline plus indentation for the first kCachedLevels levels of
+// pretty printing, held as one string ("\n" then indent characters)
+// so that the text for any of those levels is a prefix of it and
+// goes out in a single add(). Deeper levels, and anything past
+// kMaxCachedIndent characters, are completed with addIndent().
+// ==============================================================
+class IndentCache
+{
+public:
+  static constexpr unsigned long kCachedLevels{ 16 };
+  static constexpr unsigned long kMaxCachedIndent{ 1024 };
+
+  IndentCache(const unsigned long step, const char indentCharacter)
+    : newlineIndent(1 + std::min(step, kMaxCachedIndent / kCachedLevels) * kCachedLevels, indentCharacter),
+      indentCharacter(indentCharacter)
+  {
+    newlineIndent[0] = '\n';
+  }
+
+  /// @brief Append a newline followed by `count` indent characters to destination.
+  template<typename Destination> void addNewline(Destination &destination, const unsigned long count) const
+  {
+    const auto cached = std::min(count, static_cast<unsigned long>(newlineIndent.size() - 1));
+    destination.add(std::string_view(newlineIndent).substr(0, cached + 1));
+    addIndent(destination, count - cached, indentCharacter);
+  }
+  JSON_LIB_NODISCARD char character() const noexcept { return indentCharacter; }
+
+private:
+  std::string newlineIndent;
+  char indentCharacter;
+};
+
 /// @brief Append a translated, double-quoted string value to destination.
-inline void appendQuotedString(const std::string_view &value, IDestination &destination, const ITranslator &translator)
+template<typename Destination>
+void appendQuotedString(const std::string_view &value, Destination &destination, const ITranslator &translator)
 {
   destination.add('"');
-  destination.add(translator.to(value));
+  translator.addTo(value, destination);
   destination.add('"');
 }
 
+/// @brief Append a number's text to destination, formatted on the stack where it fits.
+template<typename Destination> void addNumber(Destination &destination, const Number &number)
+{
+  Number::CharsBuffer buffer;
+  if (const auto chars = number.toChars(buffer); !chars.empty()) {
+    destination.add(chars);
+  } else {
+    destination.add(number.toString());
+  }
+}
+
 /// @brief Emit a trailing comma and optional newline between collection elements.
 /// Decrements commaCount; emits nothing for the last element.
-inline void addCommaNewline(IDestination &destination, const bool pretty, std::size_t &commaCount)
+template<typename Destination>
+void addCommaNewline(Destination &destination, const bool pretty, std::size_t &commaCount)
 {
   if (commaCount-- > 0) {
     destination.add(',');
@@ -31,17 +99,27 @@ inline void addCommaNewline(IDestination &destination, const bool pretty, std::s
 
 /// @brief Emit a closing newline and back-indented spaces after a collection.
 /// No-op when not pretty-printing.
-inline void addPrettyTrailer(IDestination &destination, const bool pretty,
-                              const unsigned long indent, const unsigned long step)
+template<typename Destination>
+void addPrettyTrailer(Destination &destination, const bool pretty, const unsigned long indent, const unsigned long step)
 {
   if (pretty) {
     destination.add('\n');
     addIndent(destination, indent - step);
   }
 }
+/// @brief As above, taking the newline and indentation from an IndentCache.
+template<typename Destination>
+void addPrettyTrailer(Destination &destination,
+  const bool pretty,
+  const unsigned long indent,
+  const unsigned long step,
+  const IndentCache &indentCache)
+{
+  if (pretty) { indentCache.addNewline(destination, indent - step); }
+}
 
 /// @brief Emit `indent` spaces only when the last character written was a newline.
-inline void addIndentIfNewline(IDestination &destination, const unsigned long indent)
+template<typename Destination> void addIndentIfNewline(Destination &destination, const unsigned long indent)
 {
   if (destination.last() == '\n') { addIndent(destination, indent); }
 }
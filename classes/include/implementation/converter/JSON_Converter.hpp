@@ -1,7 +1,35 @@
 #pragma once
 
+#include <string>
+#include <string_view>
+#include <utility>
+
 namespace JSON_Lib {
 JSON_LIB_NODISCARD std::string toUtf8(char16_t utf16);
 JSON_LIB_NODISCARD std::u16string toUtf16(const std::string_view &utf8);
 JSON_LIB_NODISCARD std::string toUtf8(const std::u16string_view &utf16);
+
+// ================================================================
+// Transcoding primitives used by the conversions above, the
+// translators and file reading. They keep no state, allocate
+// nothing and write only to the caller's buffer so are safe to
+// call from any number of threads at once. Malformed input is
+// reported in the return value rather than by throwing.
+// ================================================================
+
+// Most bytes in the UTF-8 encoding of one code point
+constexpr std::size_t kMaxUtf8Bytes{ 4 };
+// Length of the run of ASCII bytes in utf8 that starts at next
+JSON_LIB_NODISCARD std::size_t asciiRun(const std::string_view &utf8, std::size_t next) noexcept;
+// Decode the UTF-8 sequence that starts at next, returning its code point and length in bytes.
+// The length is zero for an overlong, truncated or out of range sequence.
+JSON_LIB_NODISCARD std::pair<char32_t, std::size_t> decodeUtf8(const std::string_view &utf8, std::size_t next) noexcept;
+// Encode a code point as UTF-8 into bytes (room for kMaxUtf8Bytes) and return the length written
+std::size_t encodeUtf8(char32_t codePoint, char *bytes) noexcept;
+// Transcode UTF-8 into utf16 (room for utf8.size() units) and return the number of units
+// written, or npos if the UTF-8 is malformed.
+JSON_LIB_NODISCARD std::size_t utf8ToUtf16(const std::string_view &utf8, char16_t *utf16) noexcept;
+// Transcode UTF-16 into utf8 (room for 3 * utf16.size() bytes) and return the number of bytes
+// written, or npos if the UTF-16 contains an unpaired surrogate.
+JSON_LIB_NODISCARD std::size_t utf16ToUtf8(const std::u16string_view &utf16, char *utf8) noexcept;
 }// namespace JSON_Lib
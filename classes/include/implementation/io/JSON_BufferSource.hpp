@@ -2,8 +2,10 @@
 #include "JSON_Throw.hpp"
 #include "ISource.hpp"
 
+#include <memory>
 #include <string>
 #include <string_view>
+#include <tuple>
 #include <type_traits>
 
 namespace JSON_Lib {
@@ -75,6 +77,29 @@ public:
 
   JSON_LIB_NODISCARD std::size_t position() const JSON_LIB_NOEXCEPT override { return bufferPosition; }
 
+  JSON_LIB_NODISCARD std::string_view contiguous() const JSON_LIB_NOEXCEPT override
+  {
+    return buffer.substr(bufferPosition);
+  }
+
+  void advance(const std::size_t length) override
+  {
+    if (length == 0) { return; }
+    if (length > buffer.size() - bufferPosition) { JSON_THROW(Error("Tried to read past and of buffer.")); }
+    std::tie(lineNo, column) = advancePosition({ lineNo, column }, buffer.substr(bufferPosition + 1, length), length);
+    bufferPosition += length;
+  }
+
+  JSON_LIB_NODISCARD std::shared_ptr<const void> shareBuffer() override
+  {
+    // Only a buffer this source copied or was moved can be shared; views belong to the caller
+    if (sharedBuffer == nullptr && buffer.data() == ownedBuffer.data()) {
+      sharedBuffer = std::make_shared<const std::string>(std::move(ownedBuffer));
+      buffer = *sharedBuffer;
+    }
+    return sharedBuffer;
+  }
+
 private:
   static void checkNotEmpty(bool empty)
   {
@@ -85,5 +110,6 @@ private:
   std::size_t bufferPosition = 0;
   std::string ownedBuffer;
   std::string_view buffer;
+  std::shared_ptr<const std::string> sharedBuffer;
 };
 }// namespace JSON_Lib
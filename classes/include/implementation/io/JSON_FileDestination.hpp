@@ -1,6 +1,8 @@
 #pragma once
 #include "JSON_Throw.hpp"
 
+#include <algorithm>
+#include <cstdint>
 #include <fstream>
 #include <string>
 #include <string_view>
@@ -13,48 +15,119 @@
 
 namespace JSON_Lib {
 
+// ============================================================
+// Destination writing to a file. Output is gathered in a block
+// (of a size given on construction) that is written out when it
+// fills, on flush() and on close()/destruction, so a stringify
+// makes a handful of large writes rather than one per token.
+// Line feeds are written as CRLF unless LineEnding::lf is asked
+// for, in which case bytes go to the file unchanged.
+// ============================================================
 class FileDestination final : public DestinationBase
 {
 public:
-  explicit FileDestination(const std::string_view &filename) : filename(filename)
+  // How '\n' is written to the file
+  enum class LineEnding : uint8_t { lf, crlf };
+  static constexpr std::size_t kDefaultBlockSize = 64 * 1024;
+
+  explicit FileDestination(const std::string_view &filename,
+    const LineEnding lineEnding = LineEnding::crlf,
+    const std::size_t blockSize = kDefaultBlockSize)
+    : filename(filename), lineEnding(lineEnding), block(std::max<std::size_t>(blockSize, 1), '\0')
   {
+    // The block is the only buffering needed
+    destination.rdbuf()->pubsetbuf(nullptr, 0);
     destination.open(filename.data(), std::ios_base::binary | std::ios_base::trunc);
   }
   FileDestination() = delete;
+  FileDestination(const FileDestination &other) = delete;
+  FileDestination &operator=(const FileDestination &other) = delete;
+  FileDestination(FileDestination &&other) = delete;
+  FileDestination &operator=(FileDestination &&other) = delete;
+  ~FileDestination() override { writeBlock(); }
 
   void add(const char ch) override
   {
-    if (ch == '\n') {
-      destination.write("\r\n", 2);
-      fileSize += 2;
-    } else {
-      destination.put(ch);
-      fileSize++;
-    }
+    if (ch == kLineFeed && lineEnding == LineEnding::crlf) { put(kCarriageReturn); }
+    put(ch);
     trackLast(ch);
   }
   void add(const std::string &bytes) override { add(std::string_view{bytes}); }
   void add(const std::string_view &bytes) override
   {
-    for (const auto ch : bytes) { add(ch); }
-    destination.flush();
+    if (bytes.empty()) { return; }
+    if (lineEnding == LineEnding::crlf) {
+      // Copy the runs between line feeds whole
+      std::size_t start = 0;
+      for (auto lineFeed = bytes.find(kLineFeed); lineFeed != std::string_view::npos;
+           lineFeed = bytes.find(kLineFeed, start)) {
+        write(bytes.substr(start, lineFeed - start));
+        write("\r\n");
+        start = lineFeed + 1;
+      }
+      write(bytes.substr(start));
+    } else {
+      write(bytes);
+    }
+    trackLast(bytes.back());
   }
   void add(const char *bytes) override { add(std::string_view{bytes}); }
   void clear() override
   {
+    used = 0;
     if (destination.is_open()) { destination.close(); }
     destination.open(filename.c_str(), std::ios_base::binary | std::ios_base::trunc);
     if (!destination.is_open()) { JSON_THROW(Error("File output stream failed to open or could not be created.")); }
     fileSize = 0;
     trackLast(0);
   }
+  // Write out anything held in the block
+  void flush()
+  {
+    writeBlock();
+    destination.flush();
+  }
   std::string getFileName() { return filename; }
-  void close() { destination.close(); }
+  void close()
+  {
+    writeBlock();
+    destination.close();
+  }
   std::size_t size() const { return fileSize; }
 
 private:
+  void put(const char ch)
+  {
+    if (used == block.size()) { writeBlock(); }
+    block[used++] = ch;
+    fileSize++;
+  }
+  void write(const std::string_view &bytes)
+  {
+    if (bytes.size() > block.size() - used) {
+      writeBlock();
+      // Too big to gather so write it straight out
+      if (bytes.size() >= block.size()) {
+        destination.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+        fileSize += bytes.size();
+        return;
+      }
+    }
+    std::copy(bytes.begin(), bytes.end(), block.begin() + static_cast<std::ptrdiff_t>(used));
+    used += bytes.size();
+    fileSize += bytes.size();
+  }
+  void writeBlock()
+  {
+    if (used > 0 && destination.is_open()) { destination.write(block.data(), static_cast<std::streamsize>(used)); }
+    used = 0;
+  }
+
   std::ofstream destination;
   std::string filename;
+  LineEnding lineEnding;
+  std::string block;
+  std::size_t used{};
   std::size_t fileSize{};
 };
 }// namespace JSON_Lib
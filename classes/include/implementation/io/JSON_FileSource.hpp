@@ -5,6 +5,7 @@
 #include <fstream>
 #include <string>
 #include <string_view>
+#include <tuple>
 
 #if JSON_LIB_NO_STDIO
 #error "FileSource is disabled when JSON_LIB_NO_STDIO is enabled."
@@ -43,6 +44,32 @@ public:
     }
   }
   bool more() const JSON_LIB_NOEXCEPT override { return source.peek() != EOF; }
+  // Read a block from the stream in one go; as with next() a CR landed on before a LF is dropped
+  std::size_t read(char *bytes, const std::size_t length) override
+  {
+    if (length == 0 || !more()) { return 0; }
+    source.read(bytes, static_cast<std::streamsize>(length));
+    auto count = static_cast<std::size_t>(source.gcount());
+    if (source.eof()) { source.clear(); }
+    std::size_t kept = 1;
+    for (std::size_t index = 1; index < count; index++) {
+      if (bytes[index] != kCarriageReturn || (index + 1 < count ? bytes[index + 1] : current()) != kLineFeed) {
+        bytes[kept++] = bytes[index];
+      }
+    }
+    count = kept;
+    if (current() == kCarriageReturn) {
+      source.get();
+      if (current() != kLineFeed) { source.unget(); }
+    }
+    std::tie(lineNo, column) = advancePosition(getPosition(), std::string_view(bytes + 1, count - 1), count - 1);
+    column++;
+    if (current() == kLineFeed) {
+      lineNo++;
+      column = 1;
+    }
+    return count;
+  }
   void reset() override
   {
     lineNo = 1;
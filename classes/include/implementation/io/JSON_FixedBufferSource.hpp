@@ -2,6 +2,8 @@
 #include "JSON_Throw.hpp"
 
 #include <cstddef>
+#include <string_view>
+#include <tuple>
 #include "ISource.hpp"
 #include "JSON_Char_Constants.hpp"
 
@@ -60,6 +62,21 @@ public:
   }
 
   JSON_LIB_NODISCARD std::size_t position() const JSON_LIB_NOEXCEPT override { return position_; }
+
+  JSON_LIB_NODISCARD std::string_view contiguous() const JSON_LIB_NOEXCEPT override
+  {
+    if (!more()) { return {}; }
+    return { data_ + position_, length_ - position_ };
+  }
+
+  void advance(const std::size_t length) override
+  {
+    if (!valid_ || length == 0) { return; }
+    if (length > length_ - position_) { JSON_THROW(Error("Tried to read past end of buffer.")); }
+    const std::string_view landed{ data_ + position_ + 1, length_ - position_ - 1 };
+    std::tie(lineNo, column) = advancePosition({ lineNo, column }, landed.substr(0, length), length);
+    position_ += length;
+  }
   JSON_LIB_NODISCARD bool valid() const noexcept { return valid_; }
 
 private:
@@ -0,0 +1,173 @@
+#pragma once
+#include "JSON_Throw.hpp"
+
+#include <array>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <tuple>
+
+#if JSON_LIB_NO_STDIO
+#error "MappedFileSource is disabled when JSON_LIB_NO_STDIO is enabled."
+#endif
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#include <fstream>
+#include <iterator>
+#endif
+
+namespace JSON_Lib {
+
+// ============================================================
+// File source that presents the whole file as one contiguous
+// span so the parser's contiguous fast paths apply to files. On
+// POSIX systems the file is memory mapped read-only (and advised
+// as read sequentially); elsewhere it is read into memory in one
+// go. Anything that is not a regular file (a FIFO, device or
+// /proc file reports no size to map) is read into memory a block
+// at a time. Unlike FileSource a CR before a LF is read as
+// whitespace rather than being dropped; line/column positions are
+// the same.
+//
+// shareBuffer() hands out ownership of the mapping so that trees
+// parsed with borrowed strings keep it alive after the source.
+// ============================================================
+class MappedFileSource final : public ISource
+{
+public:
+  explicit MappedFileSource(const std::string_view &filename) : filename(filename), mapping(map(this->filename))
+  {
+    buffer = mapping->bytes;
+  }
+  MappedFileSource() = delete;
+  MappedFileSource(const MappedFileSource &other) = delete;
+  MappedFileSource &operator=(const MappedFileSource &other) = delete;
+  MappedFileSource(MappedFileSource &&other) = delete;
+  MappedFileSource &operator=(MappedFileSource &&other) = delete;
+  ~MappedFileSource() override = default;
+
+  JSON_LIB_NODISCARD char current() const JSON_LIB_NOEXCEPT override
+  {
+    if (more()) { return buffer[bufferPosition]; }
+    return EOF;
+  }
+
+  void next() override
+  {
+    if (!more()) { JSON_THROW(Error("Tried to read past end of file.")); }
+    bufferPosition++;
+    column++;
+    if (current() == kLineFeed) {
+      lineNo++;
+      column = 1;
+    }
+  }
+
+  JSON_LIB_NODISCARD bool more() const JSON_LIB_NOEXCEPT override { return bufferPosition < buffer.size(); }
+
+  void reset() override
+  {
+    bufferPosition = 0;
+    lineNo = 1;
+    column = 1;
+  }
+
+  JSON_LIB_NODISCARD std::size_t position() const JSON_LIB_NOEXCEPT override { return bufferPosition; }
+
+  JSON_LIB_NODISCARD std::string_view contiguous() const JSON_LIB_NOEXCEPT override
+  {
+    return buffer.substr(bufferPosition);
+  }
+
+  void advance(const std::size_t length) override
+  {
+    if (length == 0) { return; }
+    if (length > buffer.size() - bufferPosition) { JSON_THROW(Error("Tried to read past end of file.")); }
+    std::tie(lineNo, column) = advancePosition({ lineNo, column }, buffer.substr(bufferPosition + 1, length), length);
+    bufferPosition += length;
+  }
+
+  JSON_LIB_NODISCARD std::shared_ptr<const void> shareBuffer() override { return mapping; }
+
+  std::string getFileName() { return filename; }
+
+private:
+  // File contents: mapped (unmapped on destruction) or read into memory
+  struct Mapping
+  {
+    Mapping() = default;
+    Mapping(const Mapping &other) = delete;
+    Mapping &operator=(const Mapping &other) = delete;
+    Mapping(Mapping &&other) = delete;
+    Mapping &operator=(Mapping &&other) = delete;
+#if defined(__unix__) || defined(__APPLE__)
+    ~Mapping()
+    {
+      if (mapped) { ::munmap(const_cast<char *>(bytes.data()), bytes.size()); }
+    }
+    bool mapped{ false };
+#else
+    ~Mapping() = default;
+#endif
+    std::string contents;
+    std::string_view bytes;
+  };
+
+  static std::shared_ptr<const Mapping> map(const std::string &filename)
+  {
+    auto mapping = std::make_shared<Mapping>();
+#if defined(__unix__) || defined(__APPLE__)
+    const int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd == -1) { JSON_THROW(Error("File input stream failed to open or does not exist.")); }
+    struct stat status{};
+    if (::fstat(fd, &status) == -1) {
+      ::close(fd);
+      JSON_THROW(Error("File input stream failed to open or does not exist."));
+    }
+    if (!S_ISREG(status.st_mode)) {
+      // A FIFO, character device or /proc file has no size to map; read it until end of file
+      std::array<char, 64 * 1024> block{};
+      for (;;) {
+        const auto count = ::read(fd, block.data(), block.size());
+        if (count == -1 && errno == EINTR) { continue; }
+        if (count == -1) {
+          ::close(fd);
+          JSON_THROW(Error("File could not be read into memory."));
+        }
+        if (count == 0) { break; }
+        mapping->contents.append(block.data(), static_cast<std::size_t>(count));
+      }
+      mapping->bytes = mapping->contents;
+    } else if (status.st_size > 0) {
+      void *bytes = ::mmap(nullptr, static_cast<std::size_t>(status.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+      if (bytes == MAP_FAILED) {
+        ::close(fd);
+        JSON_THROW(Error("File could not be mapped into memory."));
+      }
+      ::madvise(bytes, static_cast<std::size_t>(status.st_size), MADV_SEQUENTIAL);
+      mapping->bytes = std::string_view(static_cast<const char *>(bytes), static_cast<std::size_t>(status.st_size));
+      mapping->mapped = true;
+    }
+    ::close(fd);
+#else
+    std::ifstream file{ filename, std::ios_base::binary };
+    if (!file.is_open()) { JSON_THROW(Error("File input stream failed to open or does not exist.")); }
+    mapping->contents.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    mapping->bytes = mapping->contents;
+#endif
+    return mapping;
+  }
+  void backup(const unsigned long length) override { bufferPosition -= length; }
+
+  std::string filename;
+  std::shared_ptr<const Mapping> mapping;
+  std::string_view buffer;
+  std::size_t bufferPosition = 0;
+};
+}// namespace JSON_Lib
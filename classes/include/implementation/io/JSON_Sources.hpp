@@ -5,4 +5,5 @@
 
 #if !JSON_LIB_NO_STDIO
 #include "JSON_FileSource.hpp"
+#include "JSON_MappedFileSource.hpp"
 #endif
\ No newline at end of file
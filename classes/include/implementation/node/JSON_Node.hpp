@@ -1,8 +1,12 @@
 #pragma once
 
+#include <array>
+#include <cstring>
 #include <memory>
 #include <string_view>
 #include "JSON_ErrorBase.hpp"
+#include "JSON_Arena.hpp"
+#include "JSON_Throw.hpp"
 #include <type_traits>
 #include <utility>
 #include <variant>
@@ -17,9 +21,17 @@ struct Boolean;
 struct Null;
 struct Hole;
 
-struct Node
+// ==================================================================
+// A Node is a 16 byte tagged union: numbers, booleans, nulls and
+// holes are held inline while strings, objects and arrays are held
+// out of line (allocated from the node memory resource) behind a
+// pointer. A one byte tag records which is held.
+// ==================================================================
+struct alignas(8) Node
 {
-  using Storage = std::variant<std::monostate, std::unique_ptr<Object>, std::unique_ptr<Array>, Number, String, Boolean, Null, Hole>;
+  // Objects and arrays live out of line, allocated from the node memory resource
+  using ObjectPtr = std::unique_ptr<Object, detail::NodeDelete<Object>>;
+  using ArrayPtr = std::unique_ptr<Array, detail::NodeDelete<Array>>;
 
   // Node Error
   struct Error final : std::runtime_error
@@ -28,13 +40,21 @@ struct Node
   };
   // Constructors/Destructors
   Node() = default;
-  explicit Node(std::unique_ptr<Object> value) : jNodeVariant(std::move(value)) {}
-  explicit Node(std::unique_ptr<Array> value) : jNodeVariant(std::move(value)) {}
-  explicit Node(Number value) : jNodeVariant(std::move(value)) {}
-  explicit Node(String value) : jNodeVariant(std::move(value)) {}
-  explicit Node(Boolean value) : jNodeVariant(std::move(value)) {}
-  explicit Node(Null value) : jNodeVariant(std::move(value)) {}
-  explicit Node(Hole value) : jNodeVariant(std::move(value)) {}
+  explicit Node(ObjectPtr value) noexcept : jNodeType(Type::object) { storePointer(value.release()); }
+  explicit Node(ArrayPtr value) noexcept : jNodeType(Type::array) { storePointer(value.release()); }
+  explicit Node(Number value) noexcept : jNodeType(Type::number)
+  {
+    std::construct_at(&jNodePayload.number, std::move(value));
+  }
+  // Strings are boxed in the resource their text comes from
+  explicit Node(String value) : jNodeType(Type::string)
+  {
+    std::pmr::polymorphic_allocator<String> allocator{ value.resource() };
+    storePointer(allocator.template new_object<String>(std::move(value)));
+  }
+  explicit Node(Boolean value) noexcept : jNodeType(Type::boolean) { std::construct_at(&jNodePayload.boolean, value); }
+  explicit Node(Null value) noexcept : jNodeType(Type::null) { std::construct_at(&jNodePayload.null, value); }
+  explicit Node(Hole value) noexcept : jNodeType(Type::hole) { std::construct_at(&jNodePayload.hole, value); }
   template<typename T, typename = std::enable_if_t<
       std::is_same_v<T, bool> ||
       std::is_arithmetic_v<T> ||
@@ -45,85 +65,144 @@ struct Node
   Node(const JSON::ObjectInitializer &object);
   Node(const Node &other) = delete;
   Node &operator=(const Node &other) = delete;
-  Node(Node &&other) noexcept : jNodeVariant(std::move(other.jNodeVariant))
-  {
-    other.jNodeVariant = std::monostate{};
-  }
+  Node(Node &&other) noexcept { moveFrom(other); }
   Node &operator=(Node &&other) noexcept
   {
     if (this != &other) {
-      jNodeVariant = std::move(other.jNodeVariant);
-      other.jNodeVariant = std::monostate{};
+      destroy();
+      moveFrom(other);
     }
     return *this;
   }
-  ~Node() = default;
+  ~Node() { destroy(); }
   // Assignment operators
   template<typename T> Node &operator=(T value) { return *this = Node(value); }
   // Has the variant been created
-  JSON_LIB_NODISCARD bool isEmpty() const { return std::holds_alternative<std::monostate>(jNodeVariant); }
+  JSON_LIB_NODISCARD bool isEmpty() const { return jNodeType == Type::empty; }
   // Indexing operators
   Node &operator[](const std::string_view &key);
   const Node &operator[](const std::string_view &key) const;
+  // Return the entry for a key, adding it as a Hole if not present (true if added); a Hole
+  // or empty node becomes an object first
+  std::pair<Node &, bool> try_emplace(const std::string_view &key);
   Node &operator[](std::size_t index);
   const Node &operator[](std::size_t index) const;
   void resize(std::size_t index);
   template<typename T> using BaseType = std::remove_cv_t<T>;
-  template<typename T> using StorageType = std::conditional_t<
-      std::is_same_v<BaseType<T>, Object>, std::unique_ptr<Object>,
-      std::conditional_t<std::is_same_v<BaseType<T>, Array>, std::unique_ptr<Array>, BaseType<T>>>;
 
-  template<typename T> JSON_LIB_NODISCARD bool is() const
-  {
-    return std::holds_alternative<StorageType<T>>(jNodeVariant);
-  }
+  template<typename T> JSON_LIB_NODISCARD bool is() const { return jNodeType == typeOf<BaseType<T>>(); }
 
-  template<typename T> T &get()
-  {
-    if constexpr (std::is_same_v<BaseType<T>, Object> || std::is_same_v<BaseType<T>, Array>) {
-      return *std::get<StorageType<T>>(jNodeVariant);
-    } else {
-      return std::get<StorageType<T>>(jNodeVariant);
-    }
-  }
+  // Get stored value (std::bad_variant_access if the node holds another type)
+  template<typename T> T &get() { return const_cast<T &>(std::as_const(*this).template get<T>()); }
 
   template<typename T> const T &get() const
   {
-    if constexpr (std::is_same_v<BaseType<T>, Object> || std::is_same_v<BaseType<T>, Array>) {
-      return *std::get<StorageType<T>>(jNodeVariant);
+    using Base = BaseType<T>;
+    if (jNodeType != typeOf<Base>()) { JSON_THROW(std::bad_variant_access()); }
+    if constexpr (std::is_same_v<Base, Object> || std::is_same_v<Base, Array> || std::is_same_v<Base, String>) {
+      return *loadPointer<Base>();
+    } else if constexpr (std::is_same_v<Base, Number>) {
+      return jNodePayload.number;
+    } else if constexpr (std::is_same_v<Base, Boolean>) {
+      return jNodePayload.boolean;
+    } else if constexpr (std::is_same_v<Base, Null>) {
+      return jNodePayload.null;
     } else {
-      return std::get<StorageType<T>>(jNodeVariant);
+      return jNodePayload.hole;
     }
   }
-  // Visit — calls vis with the concrete stored type (unwraps unique_ptr<Object/Array>)
+  // Visit — calls vis with the concrete stored type (std::monostate if empty)
   template<typename Visitor>
   auto visit(Visitor &&vis) const
   {
-    return std::visit([&vis](const auto &v) -> decltype(auto) {
-      using T = std::decay_t<decltype(v)>;
-      if constexpr (std::is_same_v<T, std::unique_ptr<Object>>) {
-        return vis(*v);
-      } else if constexpr (std::is_same_v<T, std::unique_ptr<Array>>) {
-        return vis(*v);
-      } else {
-        return vis(v);
-      }
-    }, jNodeVariant);
+    switch (jNodeType) {
+    case Type::object:
+      return vis(*loadPointer<Object>());
+    case Type::array:
+      return vis(*loadPointer<Array>());
+    case Type::number:
+      return vis(jNodePayload.number);
+    case Type::string:
+      return vis(*loadPointer<String>());
+    case Type::boolean:
+      return vis(jNodePayload.boolean);
+    case Type::null:
+      return vis(jNodePayload.null);
+    case Type::hole:
+      return vis(jNodePayload.hole);
+    default:
+      return vis(std::monostate{});
+    }
   }
-  // Make Node
+  // Make Node (objects/arrays are allocated from the current node memory resource)
   template<typename T, typename... Args> static auto make(Args &&...args)
   {
-    if constexpr (std::is_same_v<T, Object>) {
-      return Node{ std::make_unique<Object>(std::forward<Args>(args)...) };
-    } else if constexpr (std::is_same_v<T, Array>) {
-      return Node{ std::make_unique<Array>(std::forward<Args>(args)...) };
+    if constexpr (std::is_same_v<T, Object> || std::is_same_v<T, Array>) {
+      std::pmr::polymorphic_allocator<T> allocator{ detail::nodeResource() };
+      return Node{ std::unique_ptr<T, detail::NodeDelete<T>>{ allocator.template new_object<T>(std::forward<Args>(args)...) } };
     } else {
       return Node{ T(std::forward<Args>(args)...) };
     }
   }
 
 private:
-  Storage jNodeVariant;
+  // Type of value held
+  enum class Type : uint8_t { empty = 0, object, array, number, string, boolean, null, hole };
+  template<typename T> static constexpr Type typeOf()
+  {
+    if constexpr (std::is_same_v<T, Object>) { return Type::object; }
+    else if constexpr (std::is_same_v<T, Array>) { return Type::array; }
+    else if constexpr (std::is_same_v<T, Number>) { return Type::number; }
+    else if constexpr (std::is_same_v<T, String>) { return Type::string; }
+    else if constexpr (std::is_same_v<T, Boolean>) { return Type::boolean; }
+    else if constexpr (std::is_same_v<T, Null>) { return Type::null; }
+    else if constexpr (std::is_same_v<T, Hole>) { return Type::hole; }
+    else { return Type::empty; }
+  }
+  // Inline value or pointer to the out of line one (pointers are held as bytes so
+  // that the payload needs no alignment and the tag packs in after it)
+  union Payload {
+    Payload() noexcept {}
+    ~Payload() {}
+    std::array<unsigned char, sizeof(void *)> pointer;
+    Number number;
+    Boolean boolean;
+    Null null;
+    Hole hole;
+  };
+  template<typename T> void storePointer(T *value) noexcept { std::memcpy(jNodePayload.pointer.data(), &value, sizeof(value)); }
+  template<typename T> JSON_LIB_NODISCARD T *loadPointer() const noexcept
+  {
+    T *value;
+    std::memcpy(&value, jNodePayload.pointer.data(), sizeof(value));
+    return value;
+  }
+  // Take over another node's value, leaving it empty
+  void moveFrom(Node &other) noexcept
+  {
+    switch (other.jNodeType) {
+    case Type::number:
+      std::construct_at(&jNodePayload.number, std::move(other.jNodePayload.number));
+      std::destroy_at(&other.jNodePayload.number);
+      break;
+    case Type::boolean:
+      std::construct_at(&jNodePayload.boolean, other.jNodePayload.boolean);
+      break;
+    case Type::null:
+    case Type::hole:
+    case Type::empty:
+      break;
+    default:
+      jNodePayload.pointer = other.jNodePayload.pointer;
+      break;
+    }
+    jNodeType = std::exchange(other.jNodeType, Type::empty);
+  }
+  // Free the value held (defined once Object and Array are complete)
+  void destroy() noexcept;
+
+  Payload jNodePayload;
+  Type jNodeType{ Type::empty };
 };
 
 // Visitor helper — inherit from multiple lambdas
@@ -2,6 +2,28 @@
 
 namespace JSON_Lib {
 
+// Free the value held by a Node, returning out of line storage to the resource it came from
+inline void Node::destroy() noexcept
+{
+  switch (jNodeType) {
+  case Type::object:
+    detail::NodeDelete<Object>{}(loadPointer<Object>());
+    break;
+  case Type::array:
+    detail::NodeDelete<Array>{}(loadPointer<Array>());
+    break;
+  case Type::string:
+    detail::NodeDelete<String>{}(loadPointer<String>());
+    break;
+  case Type::number:
+    std::destroy_at(&jNodePayload.number);
+    break;
+  default:
+    break;
+  }
+  jNodeType = Type::empty;
+}
+
 // Construct Node from raw values
 template<typename T, typename>
 Node::Node(T value)
@@ -5,13 +5,14 @@ namespace JSON_Lib {
 // Object
 inline Node &Node::operator[](const std::string_view &key)
 {
-  if (isA<Hole>(*this)) {
-    *this = make<Object>();
-    NRef<Object>(*this).add(Object::Entry(key, make<Hole>()));
-    return NRef<Object>(*this).value().back().getNode();
-  }
+  if (isA<Hole>(*this)) { return try_emplace(key).first; }
   return NRef<Object>(*this)[key];
 }
+inline std::pair<Node &, bool> Node::try_emplace(const std::string_view &key)
+{
+  if (isA<Hole>(*this) || isEmpty()) { *this = make<Object>(); }
+  return NRef<Object>(*this).try_emplace(key);
+}
 inline const Node &Node::operator[](const std::string_view &key) const { return NRef<const Object>(*this)[key]; }
 // Array
 inline Node &Node::operator[](const std::size_t index)
@@ -2,6 +2,7 @@
 
 #include "JSON_Config.hpp"
 #include "JSON_Node_Core.hpp"
+#include "JSON_ParseError.hpp"
 
 namespace JSON_Lib {
 
@@ -34,30 +35,56 @@ public:
   // Get/Set parser max recursion depth (instance — not shared across JSON objects)
   void setMaxParserDepth(unsigned long depth) override { m_maxParserDepth = depth; }
   unsigned long getMaxParserDepth() const noexcept override { return m_maxParserDepth; }
+  // Get/Set whether strings parsed from contiguous sources reference the source bytes
+  void setBorrowedStrings(const bool borrow) override { m_borrowStrings = borrow; }
+  bool getBorrowedStrings() const noexcept override { return m_borrowStrings; }
 
   Node parse(ISource &source) override;
   Result<Node> parseResult(ISource &source) override;
+  void parseEvents(ISource &source, IEvents &events) override;
 
 private:
-  // Parse JSON
-  JSON_LIB_NODISCARD Object::Entry
-    parseObjectEntry(ISource &source, unsigned long parserDepth, unsigned long maxDepth);
-  JSON_LIB_NODISCARD Node
-    parseString(ISource &source, unsigned long parserDepth);
-  JSON_LIB_NODISCARD Node parseNumber(ISource &source,
+  // Parse JSON into a tree, recording errors in the JSON in m_error instead of throwing them
+  JSON_LIB_NODISCARD Node parseTree(ISource &source);
+  // Parse JSON held in contiguous memory through a SpanCursor rather than per-character ISource calls
+  JSON_LIB_NODISCARD Node parseContiguous(ISource &source, const std::string_view &span);
+  // Parse JSON (Source is ISource or SpanCursor; both present the same character-level interface)
+  template<typename Source> JSON_LIB_NODISCARD Object::Entry
+    parseObjectEntry(Source &source, unsigned long parserDepth, unsigned long maxDepth);
+  template<typename Source> JSON_LIB_NODISCARD String extractKey(Source &source);
+  template<typename Source> JSON_LIB_NODISCARD Node
+    parseString(Source &source, unsigned long parserDepth);
+  template<typename Source> JSON_LIB_NODISCARD Node parseNumber(Source &source,
     unsigned long parserDepth);
-  JSON_LIB_NODISCARD Node parseBoolean(ISource &source,
+  template<typename Source> JSON_LIB_NODISCARD Node parseBoolean(Source &source,
     unsigned long parserDepth);
-  JSON_LIB_NODISCARD Node parseNull(ISource &source,
+  template<typename Source> JSON_LIB_NODISCARD Node parseNull(Source &source,
     unsigned long parserDepth);
-  JSON_LIB_NODISCARD Node parseObject(ISource &source, unsigned long parserDepth, unsigned long maxDepth);
-  JSON_LIB_NODISCARD Node parseArray(ISource &source, unsigned long parserDepth, unsigned long maxDepth);
-  JSON_LIB_NODISCARD Node parseNodes(ISource &source, unsigned long parserDepth, unsigned long maxDepth);
+  template<typename Source> JSON_LIB_NODISCARD Node
+    parseObject(Source &source, unsigned long parserDepth, unsigned long maxDepth);
+  template<typename Source> JSON_LIB_NODISCARD Node
+    parseArray(Source &source, unsigned long parserDepth, unsigned long maxDepth);
+  template<typename Source> JSON_LIB_NODISCARD Node
+    parseNodes(Source &source, unsigned long parserDepth, unsigned long maxDepth);
+  // Raise events for JSON (Source is ISource or SpanCursor) instead of building a tree
+  template<typename Source> void
+    emitObject(Source &source, IEvents &events, unsigned long parserDepth, unsigned long maxDepth);
+  template<typename Source> void
+    emitArray(Source &source, IEvents &events, unsigned long parserDepth, unsigned long maxDepth);
+  template<typename Source> void
+    emitNodes(Source &source, IEvents &events, unsigned long parserDepth, unsigned long maxDepth);
 
   // Reference to JSON translator interface
   const ITranslator &jsonTranslator;
   // Maximum parser depth (per-instance — not shared across JSON objects)
   unsigned long m_maxParserDepth{ kDefaultMaxParserDepth };
+  // Borrow strings from contiguous sources instead of copying them
+  bool m_borrowStrings{ false };
+  // Error recorded by the last parse of a tree
+  ParseError m_error;
+  // Text of the current event string/key (reused between events and parses)
+  std::string m_eventText;
+  uint64_t m_maxEventText{};
 };
 
 }// namespace JSON_Lib
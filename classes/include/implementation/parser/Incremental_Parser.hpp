@@ -0,0 +1,122 @@
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "JSON_Config.hpp"
+#include "JSON_Node_Core.hpp"
+#include "Default_Translator.hpp"
+#include "Default_Parser.hpp"
+#include "JSON_ParseError.hpp"
+
+namespace JSON_Lib {
+
+// ============================================================
+// Resumable parser for JSON that arrives in pieces (socket reads,
+// pipes). The parse itself is carried from one chunk passed to
+// feed() to the next: the objects/arrays still open (with the
+// key waiting for its value) and the string, number or literal
+// being read are kept between calls, so a value is built as its
+// bytes arrive and is queued to be taken as soon as its last
+// byte is read. A stream may hold any number of values one after
+// another.
+//
+// Only the bytes of a string or number that spans chunks are
+// buffered. Errors report the same messages and line/column as
+// a parse of the stream as a whole, and the parser must be
+// reset() after one.
+// ============================================================
+class Incremental_Parser
+{
+public:
+  explicit Incremental_Parser(std::unique_ptr<ITranslator> translator = std::make_unique<Default_Translator>());
+  Incremental_Parser(const Incremental_Parser &other) = delete;
+  Incremental_Parser &operator=(const Incremental_Parser &other) = delete;
+  Incremental_Parser(Incremental_Parser &&other) = delete;
+  Incremental_Parser &operator=(Incremental_Parser &&other) = delete;
+  ~Incremental_Parser() = default;
+
+  // Get/Set parser max recursion depth (as for Default_Parser)
+  void setMaxParserDepth(const unsigned long depth) { m_maxParserDepth = depth; }
+  JSON_LIB_NODISCARD unsigned long getMaxParserDepth() const noexcept { return m_maxParserDepth; }
+
+  // Add the next piece of the stream; returns the number of complete values waiting
+  std::size_t feed(const std::string_view &chunk);
+  // Mark the end of the stream, completing a trailing number/literal (an unfinished
+  // object, array or string is reported as an error); returns the values waiting
+  std::size_t finish();
+  // Is a complete value waiting / is a value part way through
+  JSON_LIB_NODISCARD bool available() const noexcept { return !m_values.empty(); }
+  JSON_LIB_NODISCARD bool partial() const noexcept { return m_state != State::between; }
+  // Remove and return the oldest complete value
+  JSON_LIB_NODISCARD Node take();
+  // Forget all input and waiting values (eg. after an error)
+  void reset();
+
+private:
+  // What the parse expects next: structure (between values, a value, the first
+  // element/entry of an array/object, a key, a ':', a ',' or close) or more of a token
+  enum class State : uint8_t {
+    between,
+    value,
+    arrayFirst,
+    objectFirst,
+    key,
+    colon,
+    afterValue,
+    string,
+    number,
+    literal
+  };
+  // Object/array still open and, for an object, the key of the entry being read
+  struct Frame
+  {
+    Node jNode;
+    String key;
+    bool object{};
+  };
+  // Parse one chunk (an empty chunk stands for the end of the stream)
+  void parse(const std::string_view &chunk);
+  // Act on the structural character (or end of stream) at index of the chunk; returns the index to go on from
+  std::size_t structural(const std::string_view &chunk, std::size_t index);
+  std::size_t startValue(const std::string_view &chunk, std::size_t index);
+  // Finish a string/number from its text and add a complete value to its parent (or the queue)
+  void completeString(const std::string_view &text);
+  void completeNumber(const std::string_view &text);
+  void completeValue(Node jNode);
+  // Text of the token in progress up to index end of the chunk
+  std::string_view tokenText(const std::string_view &chunk, std::size_t start, std::size_t end);
+  // Line/column of a byte of the current chunk (index past its end for the end of stream)
+  std::pair<long, long> positionOf(const std::string_view &chunk, std::size_t index);
+  // Record a syntax error (the parse stops at it)
+  void fail(const char *message, const std::pair<long, long> &position);
+
+  std::unique_ptr<ITranslator> translator_;
+  unsigned long m_maxParserDepth{ Default_Parser::kDefaultMaxParserDepth };
+  // Parsed values waiting to be taken
+  std::deque<Node> m_values;
+  // Parse state
+  State m_state{ State::between };
+  std::vector<Frame> m_stack;
+  ParseError m_error;
+  bool m_failed{};
+  // Token in progress: bytes from earlier chunks, where it started, whether a string is a key
+  // or has an escape pending, and the literal being matched with how much of it has been
+  std::string m_token;
+  std::pair<long, long> m_origin{ 1, 1 };
+  bool m_isKey{};
+  bool m_escape{};
+  std::string_view m_literal;
+  std::size_t m_matched{};
+  // Stream offset of the next chunk and line/column of the byte at m_positionOffset
+  uint64_t m_streamOffset{};
+  uint64_t m_positionOffset{};
+  std::pair<long, long> m_position{ 1, 1 };
+};
+
+}// namespace JSON_Lib
@@ -0,0 +1,224 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include "JSON_Throw.hpp"
+#include "JSON_Char_Constants.hpp"
+#include "JSON_Escapes.hpp"
+#include "JSON_Number.hpp"
+#include "JSON_ParseError.hpp"
+#include "JSON_SpanCursor.hpp"
+
+namespace JSON_Lib {
+
+// ============================================================
+// Token level reads shared by the parsers (Default_Parser, its
+// events, Reader and Incremental_Parser). Source is an ISource
+// or a SpanCursor and errors are reported exactly as
+// Default_Parser reports them.
+// ============================================================
+
+// Longest number text accepted
+constexpr std::size_t kMaxNumberLength = 64;
+// Has the end of a number been reached in source stream?
+template<typename Source> bool endOfNumber(const Source &source)
+{
+  return source.isWS() || source.current() == JSON_Lib::kComma || source.current() == JSON_Lib::kArrayEnd
+         || source.current() == JSON_Lib::kObjectEnd;
+}
+// Extract a number from a JSON source stream, recording rather than throwing any error
+template<typename Source> Number extractNumber(Source &source, ParseError &error)
+{
+  std::array<char, kMaxNumberLength> numberText{};
+  std::size_t numberLength = 0;
+  Number::Lexer lexer;
+  while (source.more() && !endOfNumber(source)) {
+    if (numberLength >= numberText.size()) {
+      error.set(ParseError::Kind::syntax, "Number size exceeds maximum allowed length.");
+      break;
+    }
+    lexer.add(source.current());
+    numberText[numberLength++] = source.current();
+    source.next();
+  }
+  Number number = error ? Number{} : Number{ std::string_view(numberText.data(), numberLength), lexer };
+  if (!error && !number.isValid()) {
+    error.set(ParseError::Kind::syntax, "Invalid numeric value.", source.getPosition());
+  }
+  return number;
+}
+// Extract a number from a JSON source stream
+template<typename Source> Number extractNumber(Source &source)
+{
+  ParseError error;
+  Number number{ extractNumber(source, error) };
+  if (error) { error.raise(); }
+  return number;
+}
+// Extract a string as a String, recording rather than throwing any error (the source
+// is left where the error was found). Escapes are decoded and checked as it is read.
+template<typename Source> String extractString(Source &source, const ITranslator &translator, ParseError &error)
+{
+  uint64_t stringLength = 0;
+  bool translateEscapes = false;
+  // Every path returns extracted (partly built on an error) so that it is constructed in place
+  String extracted;
+  if (source.current() != '"') {
+    error.set(ParseError::Kind::syntax, "Missing opening '\"' on string.", source.getPosition());
+    return extracted;
+  }
+  if constexpr (std::is_same_v<Source, SpanCursor>) {
+    // Contiguous input with escapes: decode everything up to the closing quote in one pass
+    const auto remaining = source.remaining();
+    std::size_t escapes = 0;
+    auto end = remaining.find_first_of(R"("\)", 1);
+    while (end != std::string_view::npos && remaining[end] == JSON_Lib::kEscape) {
+      escapes++;
+      end = remaining.find_first_of(R"("\)", end + 2);
+    }
+    if (end != std::string_view::npos && escapes > 0) {
+      const auto raw = remaining.substr(1, end - 1);
+      if (raw.size() - escapes > extracted.getMaxStringLength()) {
+        error.set(ParseError::Kind::syntax, "String size exceeds maximum allowed size.");
+        return extracted;
+      }
+      std::string unescaped;
+      if (const char *message = nullptr; !tryUnescapeString(raw, translator, unescaped, message)) {
+        error.setTranslator(message);
+        return extracted;
+      }
+      extracted = String{ unescaped };
+      source.advance(end + 1);
+      return extracted;
+    }
+  }
+  source.next();
+  extracted.reserve(64);
+  while (source.more() && source.current() != JSON_Lib::kStringQuote) {
+    if constexpr (std::is_same_v<Source, SpanCursor>) {
+      // Contiguous input: copy everything up to the next quote or escape in one go
+      const auto remaining = source.remaining();
+      const auto run = static_cast<std::size_t>(std::find_if(remaining.begin(), remaining.end(), [](const char ch) {
+        return ch == JSON_Lib::kStringQuote || ch == JSON_Lib::kEscape;
+      }) - remaining.begin());
+      if (run > 0) {
+        if (stringLength + run > extracted.getMaxStringLength()) {
+          error.set(ParseError::Kind::syntax, "String size exceeds maximum allowed size.");
+          return extracted;
+        }
+        extracted.append(remaining.substr(0, run));
+        stringLength += run;
+        source.advance(run);
+        continue;
+      }
+    }
+    if (source.current() == '\\') {
+      extracted.append('\\');
+      source.next();
+      if constexpr (std::is_same_v<Source, SpanCursor>) {
+        // Escape as the last character; reading what it escapes would run off the end
+        if (!source.more()) {
+          error.set(ParseError::Kind::source, "Tried to read past end of buffer.");
+          return extracted;
+        }
+      }
+      if (!validEscape(source.current())) { extracted.pop_back(); }
+      translateEscapes = true;
+    }
+    extracted.append(source.current());
+    stringLength++;
+    if (stringLength > extracted.getMaxStringLength()) {
+      error.set(ParseError::Kind::syntax, "String size exceeds maximum allowed size.");
+      return extracted;
+    }
+    source.next();
+  }
+  if (source.current() != '"') {
+    error.set(ParseError::Kind::syntax, "Missing closing '\"' on string.", source.getPosition());
+    return extracted;
+  }
+  if (translateEscapes) {
+    std::string unescaped;
+    if (const char *message = nullptr; !translator.tryFrom(extracted.value(), unescaped, message)) {
+      error.setTranslator(message);
+      return extracted;
+    }
+    extracted = String{ unescaped };
+  }
+  source.next();
+  return extracted;
+}
+// Extract the text of a string or key. Contiguous input without escapes is returned
+// as a view of the source bytes and with escapes is decoded straight from them;
+// anything else is built up (and its escapes decoded) in buffer, which is reused
+// from one string to the next. The text is only valid
+// until the next string is extracted.
+template<typename Source>
+std::string_view
+  extractText(Source &source, const ITranslator &translator, std::string &buffer, const uint64_t maxLength)
+{
+  if (source.current() != '"') { JSON_THROW(SyntaxError(source.getPosition(), "Missing opening '\"' on string.")); }
+  if constexpr (std::is_same_v<Source, SpanCursor>) {
+    const auto remaining = source.remaining();
+    bool escaped = false;
+    auto end = remaining.find_first_of(R"("\)", 1);
+    while (end != std::string_view::npos && remaining[end] == JSON_Lib::kEscape) {
+      escaped = true;
+      end = remaining.find_first_of(R"("\)", end + 2);
+    }
+    if (end != std::string_view::npos && end - 1 <= maxLength) {
+      source.advance(end + 1);
+      if (!escaped) { return remaining.substr(1, end - 1); }
+      buffer = unescapeString(remaining.substr(1, end - 1), translator);
+      return buffer;
+    }
+  }
+  source.next();
+  bool translateEscapes = false;
+  buffer.clear();
+  while (source.more() && source.current() != JSON_Lib::kStringQuote) {
+    if (source.current() == '\\') {
+      buffer += '\\';
+      source.next();
+      if (!validEscape(source.current())) { buffer.pop_back(); }
+      translateEscapes = true;
+    }
+    buffer += source.current();
+    if (buffer.size() > maxLength) { JSON_THROW(SyntaxError("String size exceeds maximum allowed size.")); }
+    source.next();
+  }
+  if (source.current() != '"') { JSON_THROW(SyntaxError(source.getPosition(), "Missing closing '\"' on string.")); }
+  if (translateEscapes) { buffer = translator.from(buffer); }
+  source.next();
+  return buffer;
+}
+// Move past a string or key without decoding it. An escape is only stepped
+// over (so that an escaped quote does not end the string) and not checked.
+template<typename Source> void skipText(Source &source)
+{
+  if (source.current() != '"') { JSON_THROW(SyntaxError(source.getPosition(), "Missing opening '\"' on string.")); }
+  if constexpr (std::is_same_v<Source, SpanCursor>) {
+    const auto remaining = source.remaining();
+    auto end = remaining.find_first_of(R"("\)", 1);
+    while (end != std::string_view::npos && remaining[end] == JSON_Lib::kEscape) {
+      end = remaining.find_first_of(R"("\)", end + 2);
+    }
+    if (end != std::string_view::npos) {
+      source.advance(end + 1);
+      return;
+    }
+  }
+  source.next();
+  while (source.more() && source.current() != JSON_Lib::kStringQuote) {
+    if (source.current() == JSON_Lib::kEscape) { source.next(); }
+    if (source.more()) { source.next(); }
+  }
+  if (source.current() != '"') { JSON_THROW(SyntaxError(source.getPosition(), "Missing closing '\"' on string.")); }
+  source.next();
+}
+
+}// namespace JSON_Lib
@@ -0,0 +1,121 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <string_view>
+#include <vector>
+
+#include "JSON.hpp"
+#include "JSON_Node_Core.hpp"
+#include "Default_Translator.hpp"
+#include "Default_Stringify.hpp"
+#include "Default_Parser.hpp"
+
+namespace JSON_Lib {
+
+// ============================================================
+// Reader for a stream of JSON documents: newline delimited
+// (NDJSON/JSON Lines) or simply one after another. Each call
+// to read() parses the next document into a JSON instance that
+// is reused from one document to the next, so its parser and
+// settings (depth, arena, borrowed strings) apply throughout.
+// Line/column of any error is that within the whole stream.
+// ============================================================
+class JSON_Lines_Reader
+{
+public:
+  explicit JSON_Lines_Reader(ISource &source) : source_(source) {}
+  JSON_Lines_Reader(const JSON_Lines_Reader &other) = delete;
+  JSON_Lines_Reader &operator=(const JSON_Lines_Reader &other) = delete;
+  JSON_Lines_Reader(JSON_Lines_Reader &&other) = delete;
+  JSON_Lines_Reader &operator=(JSON_Lines_Reader &&other) = delete;
+  ~JSON_Lines_Reader() = default;
+
+  // Parse the next document into json; false (json left as it was) once the stream is exhausted
+  bool read(JSON &json);
+  // Exception-free read: Status::NoData once the stream is exhausted
+  JSON_LIB_NODISCARD Result<Node> readResult(JSON &json);
+  // Number of documents read so far
+  JSON_LIB_NODISCARD uint64_t count() const noexcept { return m_count; }
+
+private:
+  ISource &source_;
+  uint64_t m_count{};
+};
+
+// ============================================================
+// Writer for NDJSON/JSON Lines: each document is appended to the
+// destination as compact JSON followed by a newline. Compact
+// output escapes any newlines within strings so every document
+// occupies exactly one line.
+// ============================================================
+class JSON_Lines_Writer
+{
+public:
+  explicit JSON_Lines_Writer(IDestination &destination,
+    std::unique_ptr<ITranslator> translator = std::make_unique<Default_Translator>())
+    : destination_(destination), stringify(std::move(translator))
+  {}
+  JSON_Lines_Writer(const JSON_Lines_Writer &other) = delete;
+  JSON_Lines_Writer &operator=(const JSON_Lines_Writer &other) = delete;
+  JSON_Lines_Writer(JSON_Lines_Writer &&other) = delete;
+  JSON_Lines_Writer &operator=(JSON_Lines_Writer &&other) = delete;
+  ~JSON_Lines_Writer() = default;
+
+  // Append a document (a JSON instance's tree or a Node)
+  void write(const JSON &json);
+  void write(const Node &jNode);
+  // Number of documents written so far
+  JSON_LIB_NODISCARD uint64_t count() const noexcept { return m_count; }
+
+private:
+  IDestination &destination_;
+  Default_Stringify stringify;
+  uint64_t m_count{};
+};
+
+// ============================================================
+// Parse a buffer of NDJSON/JSON Lines records across a number of
+// worker threads. The buffer is split at line ends into blocks
+// that the workers take in turn, each with its own translator
+// and Default_Parser, so records must not span lines. Results
+// come back in input order or, through a callback, as soon as
+// each is ready (tagged with its byte offset in the buffer).
+//
+// The records read are those a JSON_Lines_Reader would read. The
+// error reported is that of the first malformed record in the
+// buffer, positioned within the whole buffer.
+// ============================================================
+class JSON_Lines_Batch
+{
+public:
+  // Called with a record's byte offset in the buffer and its parsed value
+  using RecordFn = std::function<void(std::size_t offset, Node &&record)>;
+
+  // Number of worker threads (0 = one per hardware thread)
+  explicit JSON_Lines_Batch(unsigned int threads = 0);
+
+  // Get/Set maximum parser depth for each record (as for Default_Parser)
+  void setMaxParserDepth(const unsigned long depth) { m_maxParserDepth = depth; }
+  JSON_LIB_NODISCARD unsigned long getMaxParserDepth() const noexcept { return m_maxParserDepth; }
+  JSON_LIB_NODISCARD unsigned int threads() const noexcept { return m_threads; }
+
+  // Parse every record of a buffer, returning them in input order
+  JSON_LIB_NODISCARD std::vector<Node> parse(const std::string_view &buffer) const;
+  // Parse every record of a buffer handing each to onRecord as soon as it is ready; calls are
+  // made one at a time from the worker threads (records after a malformed one may be skipped)
+  void parse(const std::string_view &buffer, const RecordFn &onRecord) const;
+
+private:
+  // Called from a worker with a record's block, offset and parsed value
+  using BlockRecordFn = std::function<void(std::size_t block, std::size_t offset, Node &&record)>;
+  // Split a buffer into blocks of whole lines
+  JSON_LIB_NODISCARD std::vector<std::string_view> split(const std::string_view &buffer) const;
+  // Parse the blocks on the workers
+  void run(const std::string_view &buffer, const std::vector<std::string_view> &blocks, const BlockRecordFn &onRecord) const;
+
+  unsigned int m_threads;
+  unsigned long m_maxParserDepth{ Default_Parser::kDefaultMaxParserDepth };
+};
+
+}// namespace JSON_Lib
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <optional>
+#include <string_view>
+#include <utility>
+
+#include "JSON_Throw.hpp"
+#include "JSON_Error.hpp"
+#include "JSON_Node_Core.hpp"
+
+namespace JSON_Lib {
+
+// ============================================================
+// Parse error recorded by the grammar rather than thrown. The
+// parse unwinds by returning once one is set; the throwing entry
+// points then raise the exception the error stands for, while
+// the Result ones turn it into a status and (lazily formatted)
+// message without an exception ever being thrown.
+// ============================================================
+class ParseError
+{
+public:
+  // Exception type the error is raised as
+  enum class Kind : uint8_t { none = 0, syntax, source, node, translator, json };
+
+  // Record an error (message must be a string literal)
+  void set(const Kind kind, const char *message) noexcept
+  {
+    m_kind = kind;
+    m_message = message;
+    m_position.reset();
+  }
+  void set(const Kind kind, const char *message, const std::pair<long, long> &position) noexcept
+  {
+    set(kind, message);
+    m_position = position;
+  }
+  // Record a failure reported by ITranslator::tryFrom() as the error from() would throw
+  void setTranslator(const char *message) noexcept
+  {
+    set(message == ITranslator::kNullCharacter ? Kind::json : Kind::translator, message);
+  }
+  void clear() noexcept { m_kind = Kind::none; }
+  // Has an error been recorded
+  explicit operator bool() const noexcept { return m_kind != Kind::none; }
+  JSON_LIB_NODISCARD Kind kind() const noexcept { return m_kind; }
+  // Status reported for the error by the Result entry points
+  JSON_LIB_NODISCARD Status status() const noexcept
+  {
+    return m_kind == Kind::syntax ? Status::SyntaxError : Status::UnknownError;
+  }
+  // Message as the exception would have it (formatted only when read)
+  JSON_LIB_NODISCARD ErrorMessage message() const
+  {
+    switch (m_kind) {
+    case Kind::syntax:
+      return ErrorMessage{ "JSON Syntax", m_message, m_position };
+    case Kind::source:
+      return ErrorMessage{ "ISource", m_message, m_position };
+    case Kind::node:
+      return ErrorMessage{ "Node", m_message, m_position };
+    case Kind::translator:
+      return ErrorMessage{ "ITranslator", m_message, m_position };
+    case Kind::json:
+      return ErrorMessage{ "JSON", m_message, m_position };
+    default:
+      return {};
+    }
+  }
+  // Throw the exception the error stands for
+  [[noreturn]] void raise() const
+  {
+    switch (m_kind) {
+    case Kind::source:
+      JSON_THROW(ISource::Error(m_message));
+    case Kind::node:
+      JSON_THROW(Node::Error(m_message));
+    case Kind::translator:
+      JSON_THROW(ITranslator::Error(m_message));
+    case Kind::json:
+      JSON_THROW(Error(m_message));
+    default:
+      if (m_position) { JSON_THROW(SyntaxError(*m_position, m_message)); }
+      JSON_THROW(SyntaxError(m_message));
+    }
+  }
+
+private:
+  Kind m_kind{ Kind::none };
+  const char *m_message{ "" };
+  std::optional<std::pair<long, long>> m_position;
+};
+
+}// namespace JSON_Lib
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "JSON_Config.hpp"
+#include "JSON_Node_Core.hpp"
+#include "Default_Translator.hpp"
+#include "Default_Parser.hpp"
+#include "JSON_SpanCursor.hpp"
+
+namespace JSON_Lib {
+
+// ============================================================
+// Pull reader over a JSON source. Each call to next() reads one
+// token (the start or end of an object/array, a key or a scalar
+// value) so that a document can be consumed incrementally; skip()
+// passes over a whole value by matching its brackets and value()
+// parses just the next value into a Node.
+//
+// The grammar, maximum depth and error reports are those of
+// Default_Parser, which is used for value(). Contiguous sources
+// are read through a SpanCursor; the source itself is brought up
+// to date when a value is parsed, the document ends or an error
+// is reported.
+// ============================================================
+class Reader
+{
+public:
+  // Tokens returned by next()
+  enum class Token : uint8_t {
+    none = 0,
+    objectStart,
+    objectEnd,
+    arrayStart,
+    arrayEnd,
+    key,
+    string,
+    number,
+    boolean,
+    null,
+    end
+  };
+
+  explicit Reader(ISource &source, std::unique_ptr<ITranslator> translator = std::make_unique<Default_Translator>());
+  Reader(const Reader &other) = delete;
+  Reader &operator=(const Reader &other) = delete;
+  Reader(Reader &&other) = delete;
+  Reader &operator=(Reader &&other) = delete;
+  ~Reader() = default;
+
+  // Get/Set maximum nesting depth (as for Default_Parser)
+  void setMaxParserDepth(const unsigned long depth) { parser.setMaxParserDepth(depth); }
+  JSON_LIB_NODISCARD unsigned long getMaxParserDepth() const noexcept { return parser.getMaxParserDepth(); }
+
+  // Read the next token (Token::end once the root value has been read)
+  Token next();
+  // Skip a value without building it: the value of the key just read, or the rest of the
+  // object/array just started (the next token is then whatever follows it). Does nothing otherwise.
+  // Only brackets, braces and quotes are matched, so a malformed value inside is not reported.
+  void skip();
+  // Parse the next value (the value of the key just read, the next array element or the root)
+  // into a Node; an empty Node is returned if there is none (eg. at the end of an array).
+  JSON_LIB_NODISCARD Node value();
+
+  // Current token and its value (text is for keys and strings and is valid until the next call)
+  JSON_LIB_NODISCARD Token token() const noexcept { return m_token; }
+  JSON_LIB_NODISCARD std::string_view text() const noexcept { return m_text; }
+  JSON_LIB_NODISCARD const Number &number() const noexcept { return m_number; }
+  JSON_LIB_NODISCARD bool boolean() const noexcept { return m_boolean; }
+  // Number of objects/arrays currently open
+  JSON_LIB_NODISCARD std::size_t depth() const noexcept { return m_open.size(); }
+
+private:
+  // What the grammar expects to read next
+  enum class Expect : uint8_t { value, firstEntry, firstElement, separator, end };
+  template<typename Source> Token step(Source &source);
+  template<typename Source> Token readValue(Source &source);
+  template<typename Source> Token readKey(Source &source);
+  template<typename Source> Token closeCollection(Source &source);
+  template<typename Source> Token skipCollection(Source &source);
+  template<typename Source> bool valueFollows(Source &source);
+  // Run a read over the cursor or the source, keeping the source in step on errors
+  template<typename Read> auto read(Read readFn);
+  // Bring the source up to the cursor / restart the cursor from the source
+  void syncSource();
+  void restartCursor();
+
+  ISource &source_;
+  std::unique_ptr<ITranslator> translator_;
+  Default_Parser parser;
+  // Cursor over contiguous sources and the number of its bytes the source has been advanced past
+  std::optional<SpanCursor> cursor_;
+  std::size_t synced_{};
+  // Open objects (true) and arrays (false)
+  std::vector<bool> m_open;
+  Expect m_expect{ Expect::value };
+  Token m_token{ Token::none };
+  std::string_view m_text;
+  std::string m_buffer;
+  Number m_number;
+  bool m_boolean{};
+  uint64_t m_maxText{};
+};
+
+}// namespace JSON_Lib
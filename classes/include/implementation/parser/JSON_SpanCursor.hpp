@@ -0,0 +1,93 @@
+#pragma once
+#include "JSON_Throw.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <string_view>
+#include <utility>
+
+#include "ISource.hpp"
+
+namespace JSON_Lib {
+
+// ============================================================
+// Non-virtual read cursor over a contiguous span of JSON text.
+// Presents the same character-level surface as ISource so the
+// parser grammar can be instantiated over either, but works on
+// raw pointers and defers line/column bookkeeping until an
+// error position is actually requested.
+// ============================================================
+class SpanCursor
+{
+public:
+  SpanCursor(const std::string_view &span, const std::pair<long, long> &origin)
+    : begin_(span.data()), cursor_(span.data()), end_(span.data() + span.size()), furthest_(span.data()),
+      origin_(origin)
+  {
+  }
+  SpanCursor(const SpanCursor &) = delete;
+  SpanCursor &operator=(const SpanCursor &) = delete;
+  SpanCursor(SpanCursor &&) = delete;
+  SpanCursor &operator=(SpanCursor &&) = delete;
+  ~SpanCursor() = default;
+
+  JSON_LIB_NODISCARD char current() const noexcept { return cursor_ < end_ ? *cursor_ : static_cast<char>(EOF); }
+  void next()
+  {
+    if (cursor_ >= end_) { JSON_THROW(ISource::Error("Tried to read past end of buffer.")); }
+    ++cursor_;
+  }
+  JSON_LIB_NODISCARD bool more() const noexcept { return cursor_ < end_; }
+  JSON_LIB_NODISCARD bool isWS() const noexcept
+  {
+    return cursor_ < end_ && (*cursor_ == ' ' || *cursor_ == '\t' || *cursor_ == '\n' || *cursor_ == '\r');
+  }
+  void ignoreWS() noexcept
+  {
+    while (isWS()) { ++cursor_; }
+  }
+  // Match a literal at the cursor, advancing past it on success.  A failed match leaves
+  // the cursor where it was but, like ISource, reports error positions past the bytes
+  // that did match.
+  JSON_LIB_NODISCARD bool match(const std::string_view &targetString) noexcept
+  {
+    const auto available = static_cast<std::size_t>(end_ - cursor_);
+    const auto compared = std::min(available, targetString.size());
+    const auto mismatch = std::mismatch(cursor_, cursor_ + compared, targetString.begin());
+    if (mismatch.first == cursor_ + targetString.size()) {
+      cursor_ += targetString.size();
+      return true;
+    }
+    furthest_ = std::max(furthest_, mismatch.first);
+    return false;
+  }
+  // Unread remainder of the span and a bulk advance within it
+  JSON_LIB_NODISCARD std::string_view remaining() const noexcept
+  {
+    return { cursor_, static_cast<std::size_t>(end_ - cursor_) };
+  }
+  void advance(const std::size_t length) noexcept { cursor_ += length; }
+  // Number of bytes consumed since the cursor was created
+  JSON_LIB_NODISCARD std::size_t consumed() const noexcept { return static_cast<std::size_t>(cursor_ - begin_); }
+  // Number of bytes the source must step over to report the same error position as ISource
+  JSON_LIB_NODISCARD std::size_t errorOffset() const noexcept
+  {
+    return static_cast<std::size_t>(std::max(cursor_, furthest_) - begin_);
+  }
+  // Line/column are only worked out when asked for (i.e. on an error path)
+  JSON_LIB_NODISCARD std::pair<long, long> getPosition() const noexcept
+  {
+    const std::string_view span{ begin_, static_cast<std::size_t>(end_ - begin_) };
+    const auto steps = errorOffset();
+    return advancePosition(origin_, span.substr(std::min<std::size_t>(1, span.size()), steps), steps);
+  }
+
+private:
+  const char *begin_;
+  const char *cursor_;
+  const char *end_;
+  const char *furthest_;
+  std::pair<long, long> origin_;
+};
+
+}// namespace JSON_Lib
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+#include "JSON_Config.hpp"
+#include "JSON_Node_Core.hpp"
+#include "Default_Translator.hpp"
+#include "Default_Parser.hpp"
+
+namespace JSON_Lib {
+
+// ============================================================
+// Two-stage parser for input held in contiguous memory.
+//
+// Stage one classifies the input 64 bytes at a time using SIMD
+// compares (AVX2 or SSE2 where available, otherwise a scalar
+// kernel that produces identical masks) and records the offset
+// of every structural character, opening quote and scalar start
+// that lies outside a string.  Stage two walks that index and
+// builds the same Node tree that Default_Parser would.
+//
+// Sources that are not contiguous, and any input stage two does
+// not accept, are handed to an internal Default_Parser so that
+// results and error reports are always identical to it.
+// ============================================================
+class Structural_Parser final : public IParser
+{
+public:
+  // Stage one classification kernel
+  enum class Kernel : uint8_t { automatic = 0, scalar, sse2, avx2 };
+
+  explicit Structural_Parser(std::unique_ptr<ITranslator> translator = std::make_unique<Default_Translator>(),
+    Kernel kernel = Kernel::automatic);
+  Structural_Parser(const Structural_Parser &other) = delete;
+  Structural_Parser &operator=(const Structural_Parser &other) = delete;
+  Structural_Parser(Structural_Parser &&other) = delete;
+  Structural_Parser &operator=(Structural_Parser &&other) = delete;
+  ~Structural_Parser() override = default;
+
+  // Get/Set parser max recursion depth (shared with the fallback parser)
+  void setMaxParserDepth(const unsigned long depth) override { fallback.setMaxParserDepth(depth); }
+  unsigned long getMaxParserDepth() const noexcept override { return fallback.getMaxParserDepth(); }
+  // Get/Set borrowed strings (shared with the fallback parser)
+  void setBorrowedStrings(const bool borrow) override { fallback.setBorrowedStrings(borrow); }
+  bool getBorrowedStrings() const noexcept override { return fallback.getBorrowedStrings(); }
+
+  // Select the stage one kernel; a kernel the CPU does not support selects the best one that it does
+  void setKernel(Kernel kernel) noexcept;
+  JSON_LIB_NODISCARD Kernel getKernel() const noexcept { return m_kernel; }
+  JSON_LIB_NODISCARD static bool isKernelSupported(Kernel kernel) noexcept;
+
+  Node parse(ISource &source) override;
+  Result<Node> parseResult(ISource &source) override;
+  // Events are raised straight from the source by the fallback parser (no index is needed)
+  void parseEvents(ISource &source, IEvents &events) override { fallback.parseEvents(source, events); }
+
+private:
+  // Parse contiguous input through the structural index (false if it is not accepted)
+  JSON_LIB_NODISCARD bool parseIndexed(ISource &source, const std::string_view &span, Node &root);
+
+  // Translator used for string escapes (owned, shared with the fallback parser)
+  std::unique_ptr<ITranslator> translator_;
+  // Character-at-a-time parser used for non-contiguous input and error reporting
+  Default_Parser fallback;
+  // Active stage one kernel
+  Kernel m_kernel{ Kernel::scalar };
+  // Structural index storage, reused between parses
+  std::vector<std::size_t> m_index;
+};
+
+}// namespace JSON_Lib
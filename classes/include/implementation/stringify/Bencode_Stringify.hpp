@@ -25,11 +25,13 @@ public:
   /// <param name="indent">Current print indentation.</param>
   void stringify(const Node &jNode, IDestination &destination, const unsigned long indent) const override
   {
-    stringifyNodes(jNode, destination, indent);
+    StringifyBuffer buffer{ destination };
+    stringifyNodes(jNode, buffer, indent);
+    buffer.flush();
   }
 
 private:
-  static void stringifyNodes(const Node &jNode, IDestination &destination, const unsigned long)
+  static void stringifyNodes(const Node &jNode, StringifyBuffer &destination, const unsigned long)
   {
     jNode.visit(overloaded{
       [&](const Number &) { stringifyNumber(jNode, destination); },
@@ -42,7 +44,7 @@ private:
       [&](const std::monostate &) { JSON_THROW(Error("Unknown Node type encountered during stringification.")); }
     });
   }
-  static void stringifyObject(const Node &jNode, IDestination &destination, const unsigned long)
+  static void stringifyObject(const Node &jNode, StringifyBuffer &destination, const unsigned long)
   {
     destination.add('d');
     for (auto &entry : NRef<Object>(jNode).value()) {
@@ -51,19 +53,19 @@ private:
     }
     destination.add("e");
   }
-  static void stringifyArray(const Node &jNode, IDestination &destination, const unsigned long)
+  static void stringifyArray(const Node &jNode, StringifyBuffer &destination, const unsigned long)
   {
     destination.add('l');
     for (auto &entry : NRef<Array>(jNode).value()) { stringifyNodes(entry, destination, 0); }
     destination.add("e");
   }
-  static void stringifyNumber(const Node &jNode, IDestination &destination)
+  static void stringifyNumber(const Node &jNode, StringifyBuffer &destination)
   {
     destination.add('i');
-    destination.add(std::to_string(NRef<Number>(jNode).value<long long>()));
+    addNumber(destination, Number{ NRef<Number>(jNode).value<long long>() });
     destination.add('e');
   }
-  static void stringifyBoolean(const Node &jNode, IDestination &destination)
+  static void stringifyBoolean(const Node &jNode, StringifyBuffer &destination)
   {
     if (NRef<Boolean>(jNode).value()) {
       destination.add("4:True");
@@ -71,12 +73,12 @@ private:
       destination.add("5:False");
     }
   }
-  static void stringifyNull(const Node &, IDestination &destination) { destination.add("4:null"); }
-  static void stringifyString(const Node &jNode, IDestination &destination)
+  static void stringifyNull(const Node &, StringifyBuffer &destination) { destination.add("4:null"); }
+  static void stringifyString(const Node &jNode, StringifyBuffer &destination)
   {
     stringifyString(NRef<String>(jNode).value(), destination);
   }
-  static void stringifyString(const std::string_view &value, IDestination &destination)
+  static void stringifyString(const std::string_view &value, StringifyBuffer &destination)
   {
     destination.add(std::to_string(static_cast<int>(value.length())));
     destination.add(':');
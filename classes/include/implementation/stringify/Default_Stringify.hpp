@@ -32,7 +32,9 @@ public:
   /// <param name="indent">Current print indentation.</param>
   void stringify(const Node &jNode, IDestination &destination, const unsigned long indent) const override
   {
-    stringifyNodes(jNode, destination, indent);
+    StringifyBuffer buffer{ destination };
+    stringifyNodes(jNode, buffer, indent);
+    buffer.flush();
   }
 
   // Set print indent value
@@ -40,12 +42,23 @@ public:
   {
     if (indent < 0) { JSON_THROW(JSON_Lib::Error("Invalid print indentation value.")); }
     m_indent = indent;
+    m_indentCache = IndentCache{ static_cast<unsigned long>(m_indent), m_indentCache.character() };
   }
   // Get print indent value
   long getIndent() const JSON_LIB_NOEXCEPT override { return m_indent; }
+  // Set print indent character (space or tab)
+  void setIndentCharacter(const char indentCharacter) override
+  {
+    if (indentCharacter != ' ' && indentCharacter != '\t') {
+      JSON_THROW(JSON_Lib::Error("Invalid print indentation character."));
+    }
+    m_indentCache = IndentCache{ static_cast<unsigned long>(m_indent), indentCharacter };
+  }
+  // Get print indent character
+  char getIndentCharacter() const JSON_LIB_NOEXCEPT override { return m_indentCache.character(); }
 
 private:
-  void stringifyNodes(const Node &jNode, IDestination &destination, const unsigned long indent) const
+  void stringifyNodes(const Node &jNode, StringifyBuffer &destination, const unsigned long indent) const
   {
     jNode.visit(overloaded{
       [&](const Number &) { stringifyNumber(jNode, destination); },
@@ -61,64 +74,65 @@ private:
 
 
 
-  void stringifyObject(const Node &jNode, IDestination &destination, const unsigned long indent) const
+  void stringifyObject(const Node &jNode, StringifyBuffer &destination, const unsigned long indent) const
   {
     const auto &entries = NRef<Object>(jNode).value();
     const bool pretty = indent != 0;
     size_t commaCount = entries.empty() ? 0 : entries.size() - 1;
     destination.add('{');
-    if (pretty) { destination.add('\n'); }
+    if (pretty && entries.empty()) { destination.add('\n'); }
     for (auto &entry : entries) {
-      if (pretty) { addIndent(destination, indent); }
+      if (pretty) { m_indentCache.addNewline(destination, indent); }
       stringifyString(entry.getKey(), destination);
       destination.add(':');
       if (pretty) { destination.add(' '); }
       stringifyNodes(entry.getNode(), destination, pretty ? indent + m_indent : 0);
-      addCommaNewline(destination, pretty, commaCount);
+      if (commaCount-- > 0) { destination.add(','); }
     }
-    addPrettyTrailer(destination, pretty, indent, static_cast<unsigned long>(m_indent));
+    addPrettyTrailer(destination, pretty, indent, static_cast<unsigned long>(m_indent), m_indentCache);
     destination.add('}');
   }
 
-  void stringifyArray(const Node &jNode, IDestination &destination, const unsigned long indent) const
+  void stringifyArray(const Node &jNode, StringifyBuffer &destination, const unsigned long indent) const
   {
     const auto &elements = NRef<Array>(jNode).value();
     const bool pretty = indent != 0;
     destination.add('[');
     if (!elements.empty()) {
       size_t commaCount = elements.size() - 1;
-      if (pretty) { destination.add('\n'); }
       for (auto &entry : elements) {
-        if (pretty) { addIndent(destination, indent); }
+        if (pretty) { m_indentCache.addNewline(destination, indent); }
         stringifyNodes(entry, destination, pretty ? indent + m_indent : 0);
-        addCommaNewline(destination, pretty, commaCount);
+        if (commaCount-- > 0) { destination.add(','); }
       }
-      addPrettyTrailer(destination, pretty, indent, static_cast<unsigned long>(m_indent));
+      addPrettyTrailer(destination, pretty, indent, static_cast<unsigned long>(m_indent), m_indentCache);
     }
     destination.add(']');
   }
 
-  static void stringifyNumber(const Node &jNode, IDestination &destination)
+  static void stringifyNumber(const Node &jNode, StringifyBuffer &destination)
   {
-    destination.add(NRef<Number>(jNode).toString());
+    addNumber(destination, NRef<Number>(jNode));
   }
-  static void stringifyBoolean(const Node &jNode, IDestination &destination)
+  static void stringifyBoolean(const Node &jNode, StringifyBuffer &destination)
   {
     destination.add(NRef<Boolean>(jNode).toString());
   }
-  static void stringifyNull(const Node &, IDestination &destination)
+  static void stringifyNull(const Node &, StringifyBuffer &destination)
   {
     destination.add("null");
   }
-  void stringifyString(const Node &jNode, IDestination &destination) const
+  void stringifyString(const Node &jNode, StringifyBuffer &destination) const
   {
     appendQuotedString(NRef<String>(jNode).value(), destination, *translator_);
   }
-  void stringifyString(const std::string_view &value, IDestination &destination) const
+  void stringifyString(const std::string_view &value, StringifyBuffer &destination) const
   {
     appendQuotedString(value, destination, *translator_);
   }
   long m_indent{ 4 };
+  // Newline plus indentation for each print level
+  IndentCache m_indentCache{ 4, ' ' };
 };
 
 }// namespace JSON_Lib
@@ -4,6 +4,7 @@
 #include "IStringify.hpp"
 #include "ITranslator.hpp"
 #include "JSON_StringUtils.hpp"
+#include "JSON_StringifyBuffer.hpp"
 
 namespace JSON_Lib {
 
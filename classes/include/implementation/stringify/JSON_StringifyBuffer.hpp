@@ -0,0 +1,81 @@
+#pragma once
+
+#include <array>
+#include <cstring>
+#include <string_view>
+
+#include "JSON_Config.hpp"
+#include "IDestination.hpp"
+
+namespace JSON_Lib {
+
+// ============================================================
+// Output block used internally by the stringifiers (and by
+// JSON::strip() for the runs it writes). Tokens are
+// appended into a fixed local block that is handed to the user's
+// IDestination in one add() whenever it fills (and by flush() at
+// the end). Writes larger than the block go straight through.
+// last() is answered from the block so no destination call is
+// needed for it. The class is final so calls made through a
+// StringifyBuffer reference are not virtual; it is still an
+// IDestination so translators can write escaped text into it.
+// ============================================================
+class StringifyBuffer final : public IDestination
+{
+public:
+#if JSON_LIB_EMBEDDED
+  static constexpr std::size_t kBlockSize{ 256 };
+#else
+  static constexpr std::size_t kBlockSize{ 8 * 1024 };
+#endif
+
+  explicit StringifyBuffer(IDestination &destination) : destination(destination) {}
+  StringifyBuffer() = delete;
+  StringifyBuffer(const StringifyBuffer &other) = delete;
+  StringifyBuffer &operator=(const StringifyBuffer &other) = delete;
+  StringifyBuffer(StringifyBuffer &&other) = delete;
+  StringifyBuffer &operator=(StringifyBuffer &&other) = delete;
+  ~StringifyBuffer() override = default;
+
+  void add(const std::string &bytes) override { add(std::string_view(bytes)); }
+  void add(const char *bytes) override { add(std::string_view(bytes)); }
+  void add(const char ch) override
+  {
+    if (used == kBlockSize) { flush(); }
+    block[used++] = ch;
+  }
+  void add(const std::string_view &bytes) override
+  {
+    if (bytes.size() > kBlockSize - used) {
+      flush();
+      if (bytes.size() >= kBlockSize) {
+        destination.add(bytes);
+        return;
+      }
+    }
+    std::memcpy(block.data() + used, bytes.data(), bytes.size());
+    used += bytes.size();
+  }
+  JSON_LIB_NODISCARD char last() override
+  {
+    if (used > 0) { return block[used - 1]; }
+    return destination.last();
+  }
+  // Discard any output not yet passed on to the destination
+  void clear() override { used = 0; }
+  // Pass any buffered output on to the destination
+  void flush()
+  {
+    if (used > 0) {
+      destination.add(std::string_view(block.data(), used));
+      used = 0;
+    }
+  }
+
+private:
+  IDestination &destination;
+  std::array<char, kBlockSize> block;
+  std::size_t used{};
+};
+
+}// namespace JSON_Lib
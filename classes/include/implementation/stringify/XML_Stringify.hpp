@@ -27,14 +27,16 @@ public:
   void
     stringify(const Node &jNode, IDestination &destination, const unsigned long) const override
   {
-    destination.add(R"(<?xml version="1.0" encoding="UTF-8"?>)");
-    destination.add("<root>");
-    stringifyNodes(jNode, destination, 0);
-    destination.add("</root>");
+    StringifyBuffer buffer{ destination };
+    buffer.add(R"(<?xml version="1.0" encoding="UTF-8"?>)");
+    buffer.add("<root>");
+    stringifyNodes(jNode, buffer, 0);
+    buffer.add("</root>");
+    buffer.flush();
   }
 
 private:
-  void stringifyNodes(const Node &jNode, IDestination &destination, const long) const
+  void stringifyNodes(const Node &jNode, StringifyBuffer &destination, const long) const
   {
     jNode.visit(overloaded{
       [&](const Number &) { stringifyNumber(jNode, destination); },
@@ -47,7 +49,7 @@ private:
       [&](const std::monostate &) { JSON_THROW(Error("Unknown Node type encountered during stringification.")); }
     });
   }
-  void stringifyObject(const Node &jNode, IDestination &destination, const unsigned long) const
+  void stringifyObject(const Node &jNode, StringifyBuffer &destination, const unsigned long) const
   {
     for (const auto &jNodeNext : NRef<Object>(jNode).value()) {
       std::string elementName { jNodeNext.getKey()};
@@ -61,7 +63,7 @@ private:
       destination.add('>');
     }
   }
-  void stringifyArray(const Node &jNode, IDestination &destination, const unsigned long) const
+  void stringifyArray(const Node &jNode, StringifyBuffer &destination, const unsigned long) const
   {
     if (NRef<Array>(jNode).value().size() > 1) {
       for (const auto &bNodeNext : NRef<Array>(jNode).value()) {
@@ -71,11 +73,11 @@ private:
       }
     }
   }
-  static void stringifyNumber(const Node &jNode, IDestination &destination)
+  static void stringifyNumber(const Node &jNode, StringifyBuffer &destination)
   {
-    destination.add(std::to_string(NRef<Number>(jNode).value<long long>()));
+    addNumber(destination, Number{ NRef<Number>(jNode).value<long long>() });
   }
-  static void stringifyBoolean(const Node &jNode, IDestination &destination)
+  static void stringifyBoolean(const Node &jNode, StringifyBuffer &destination)
   {
     if (NRef<Boolean>(jNode).value()) {
       destination.add("True");
@@ -83,10 +85,10 @@ private:
       destination.add("False");
     }
   }
-  static void stringifyNull(const Node &, IDestination &) {}
-  void stringifyString(const Node &jNode, IDestination &destination) const
+  static void stringifyNull(const Node &, StringifyBuffer &) {}
+  void stringifyString(const Node &jNode, StringifyBuffer &destination) const
   {
-    destination.add(translator_->to(NRef<String>(jNode).value()));
+    translator_->addTo(NRef<String>(jNode).value(), destination);
   }
 };
 
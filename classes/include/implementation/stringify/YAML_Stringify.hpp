@@ -25,13 +25,15 @@ public:
   void
     stringify(const Node &jNode, IDestination &destination, const unsigned long) const override
   {
-    destination.add("---\n");
-    stringifyNodes(jNode, destination, 0);
-    destination.add("...\n");
+    StringifyBuffer buffer{ destination };
+    buffer.add("---\n");
+    stringifyNodes(jNode, buffer, 0);
+    buffer.add("...\n");
+    buffer.flush();
   }
 
 private:
-  void stringifyNodes(const Node &jNode, IDestination &destination, const unsigned long indent) const
+  void stringifyNodes(const Node &jNode, StringifyBuffer &destination, const unsigned long indent) const
   {
     jNode.visit(overloaded{
       [&](const Object &) { stringifyObject(jNode, destination, indent); },
@@ -43,13 +45,13 @@ private:
       [&](const auto &) {}
     });
   }
-  void stringifyObject(const Node &jNode, IDestination &destination, const unsigned long indent) const
+  void stringifyObject(const Node &jNode, StringifyBuffer &destination, const unsigned long indent) const
   {
     if (!NRef<Object>(jNode).value().empty()) {
       for (const auto &entryNode : NRef<Object>(jNode).value()) {
         addIndentIfNewline(destination, indent);
         destination.add('"');
-        destination.add(translator_->to(entryNode.getKey()));
+        translator_->addTo(entryNode.getKey(), destination);
         destination.add("\": ");
         entryNode.getNode().visit(overloaded{
           [&](const Array &)  { destination.add('\n'); },
@@ -62,7 +64,7 @@ private:
       destination.add("{}\n");
     }
   }
-  void stringifyArray(const Node &jNode, IDestination &destination, const unsigned long indent) const
+  void stringifyArray(const Node &jNode, StringifyBuffer &destination, const unsigned long indent) const
   {
     if (!NRef<Array>(jNode).value().empty()) {
       for (const auto &jNodeNext : NRef<Array>(jNode).value()) {
@@ -74,25 +76,25 @@ private:
       destination.add("[]\n");
     }
   }
-  static void stringifyNumber(const Node &jNode, IDestination &destination)
+  static void stringifyNumber(const Node &jNode, StringifyBuffer &destination)
   {
-    destination.add(NRef<Number>(jNode).toString());
+    addNumber(destination, NRef<Number>(jNode));
     destination.add('\n');
   }
-  static void stringifyBoolean(const Node &jNode, IDestination &destination)
+  static void stringifyBoolean(const Node &jNode, StringifyBuffer &destination)
   {
     destination.add(NRef<Boolean>(jNode).toString());
     destination.add('\n');
   }
-  static void stringifyNull(const Node &jNode, IDestination &destination)
+  static void stringifyNull(const Node &jNode, StringifyBuffer &destination)
   {
     destination.add(NRef<Null>(jNode).toString());
     destination.add('\n');
   }
-  void stringifyString(const Node &jNode, IDestination &destination) const
+  void stringifyString(const Node &jNode, StringifyBuffer &destination) const
   {
     destination.add('"');
-    destination.add(translator_->to(NRef<String>(jNode).value()));
+    translator_->addTo(NRef<String>(jNode).value(), destination);
     destination.add("\"\n");
   }
 };
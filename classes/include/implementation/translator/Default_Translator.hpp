@@ -27,11 +27,8 @@ public:
 
   // Convert to/from JSON escaped characters
   std::string from(const std::string_view &escapedString) const override;
+  bool tryFrom(const std::string_view &escapedString, std::string &unescaped, const char *&message) const override;
   std::string to(const std::string_view &rawString) const override;
-
-private:
-  // To/From escape sequence lookup maps
-  std::unordered_map<char, char16_t> fromEscape;
-  std::unordered_map<char16_t, char> toEscape;
+  void addTo(const std::string_view &rawString, IDestination &destination) const override;
 };
 }// namespace JSON_Lib
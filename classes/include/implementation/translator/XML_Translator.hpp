@@ -17,29 +17,31 @@ public:
   JSON_LIB_NODISCARD std::string to(const std::string_view &rawString) const override
   {
     std::string translated;
-    for (const char16_t ch : toUtf16(rawString)) {
-      if (isASCII(ch) && std::isprint(ch)) {
-        if (ch == '&') {
+    for (std::size_t next = 0; next < rawString.size();) {
+      const auto [codePoint, length] = decodeUtf8(rawString, next);
+      if (length == 0) { JSON_THROW(Error("Invalid UTF-8 character sequence.")); }
+      if (codePoint == 0) { JSON_THROW(JSON_Lib::Error("Tried to convert a null character.")); }
+      next += length;
+      if (isASCII(codePoint) && std::isprint(static_cast<int>(codePoint))) {
+        if (codePoint == '&') {
           translated += "&amp;";
-        } else if (ch == '<') {
+        } else if (codePoint == '<') {
           translated += "&lt;";
-        } else if (ch == '>') {
+        } else if (codePoint == '>') {
           translated += "&gt;";
-        } else if (ch == '\'') {
+        } else if (codePoint == '\'') {
           translated += "&apos;";
-        } else if (ch == '"') {
+        } else if (codePoint == '"') {
           translated += "&quot;";
         } else {
-          translated += static_cast<char>(ch);
+          translated += static_cast<char>(codePoint);
         }
+      } else if (codePoint > 0xFFFF) {
+        // Outside the BMP: one reference per UTF-16 surrogate
+        addCharacterReference(translated, static_cast<char16_t>(0xD800 + ((codePoint - 0x10000) >> 10)));
+        addCharacterReference(translated, static_cast<char16_t>(0xDC00 + ((codePoint - 0x10000) & 0x3FF)));
       } else {
-        translated += "&#x";
-        const auto digits = "0123456789ABCDEF";
-        translated += digits[ch >> 12 & 0x0f];
-        translated += digits[ch >> 8 & 0x0f];
-        translated += digits[ch >> 4 & 0x0f];
-        translated += digits[ch&0x0f];
-        translated += ";";
+        addCharacterReference(translated, static_cast<char16_t>(codePoint));
       }
     }
     return translated;
@@ -49,8 +51,23 @@ private:
   /// <summary>
   /// Determine whether passed in character is valid ASCII
   /// </summary>
-  /// <param name="utf16Char">UTF16 character.</param>
+  /// <param name="codePoint">Unicode code point.</param>
   /// <returns>True if valid ASCII.</returns>
-  JSON_LIB_NODISCARD static bool isASCII(const char16_t utf16Char) { return utf16Char > 0x001F && utf16Char < 0x0080; }
+  JSON_LIB_NODISCARD static bool isASCII(const char32_t codePoint) { return codePoint > 0x001F && codePoint < 0x0080; }
+  /// <summary>
+  /// Append the "&#xhhhh;" character reference for a UTF16 character.
+  /// </summary>
+  /// <param name="translated">String to append to.</param>
+  /// <param name="ch">UTF16 character.</param>
+  static void addCharacterReference(std::string &translated, const char16_t ch)
+  {
+    const auto digits = "0123456789ABCDEF";
+    translated += "&#x";
+    translated += digits[ch >> 12 & 0x0f];
+    translated += digits[ch >> 8 & 0x0f];
+    translated += digits[ch >> 4 & 0x0f];
+    translated += digits[ch & 0x0f];
+    translated += ";";
+  }
 };
 }// namespace JSON_Lib
\ No newline at end of file
@@ -1,6 +1,7 @@
 #pragma once
 #include "JSON_Throw.hpp"
 
+#include <memory_resource>
 #include <vector>
 
 namespace JSON_Lib {
@@ -8,9 +9,9 @@ namespace JSON_Lib {
 struct Array
 {
   using Entry = Node;
-  using Entries = std::vector<Entry>;
-  // Constructors/Destructors
-  Array() = default;
+  using Entries = std::pmr::vector<Entry>;
+  // Constructors/Destructors (storage comes from the current node memory resource)
+  Array() : jNodeArray(detail::nodeResource()) {}
   Array(const Array &other) = default;
   Array &operator=(const Array &other) = default;
   Array(Array &&other) = default;
@@ -27,6 +28,11 @@ struct Array
   // Return reference to array base
   Entries &value() { return jNodeArray; }
   JSON_LIB_NODISCARD const Entries &value() const { return jNodeArray; }
+  // Memory resource array storage is allocated from
+  JSON_LIB_NODISCARD std::pmr::memory_resource *resource() const noexcept
+  {
+    return jNodeArray.get_allocator().resource();
+  }
   // Array indexing operators
   Node &operator[](const std::size_t index) { return jNodeArray[checkBounds(index)]; }
   const Node &operator[](const std::size_t index) const { return jNodeArray[checkBounds(index)]; }
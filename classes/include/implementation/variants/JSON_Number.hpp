@@ -2,41 +2,74 @@
 #include "JSON_Throw.hpp"
 
 #include "JSON_Config.hpp"
+#include "JSON_Arena.hpp"
+#include <algorithm>
+#include <array>
 #include <charconv>
+#include <cstring>
+#include <limits>
+#include <memory_resource>
 #include <string>
 #include <string_view>
 #include <type_traits>
 #include <variant>
-#if JSON_LIB_EMBEDDED
-#include <array>
-#else
-#include <iomanip>
-#include <sstream>
-#endif
 
 namespace JSON_Lib {
 
 struct Number
 {
-  // Number values variant
-  using Values = std::variant<std::monostate, int, long, long long, float, double, long double>;
   // All string conversions are for base 10
   static constexpr int kStringConversionBase{ 10 };
-  // Floating point notation
-  enum class numberNotation { normal = 0, fixed, scientific };
+  // Floating point notation (shortest is the fewest digits that read back as the same value; it ignores precision)
+  enum class numberNotation { normal = 0, fixed, scientific, shortest };
+  // Records the shape of number text (sign, integer digits, decimal point/exponent) one character
+  // at a time as it is scanned so that its storage type can then be picked in a single step.
+  class Lexer
+  {
+  public:
+    void add(char ch) noexcept;
+
+  private:
+    friend struct Number;
+    enum class Shape : uint8_t { start, sign, integer, floatingPoint, other };
+    // Integer digits that always fit in a long long (any more and it is converted the slow way)
+    static constexpr int kMaxExactDigits{ 18 };
+    uint64_t mantissa{};
+    int digits{};
+    bool negative{};
+    Shape shape{ Shape::start };
+  };
+  // Buffer for toChars(); big enough for any value other than a few fixed/high precision floating point ones
+  using CharsBuffer = std::array<char, 64>;
   // Constructors/Destructors
   Number() = default;
   explicit Number(const std::string_view &value) { convertNumber(value); }
+  // Number from text already fed through a Lexer
+  Number(const std::string_view &value, const Lexer &lexer) { convertNumber(value, lexer); }
   template<typename T> explicit Number(T value);
-  Number(const Number &other) = default;
-  Number &operator=(const Number &other) = default;
-  Number(Number &&other) = default;
-  Number &operator=(Number &&other) = default;
-  ~Number() = default;
+  Number(const Number &other) { copyFrom(other); }
+  Number &operator=(const Number &other)
+  {
+    if (this != &other) {
+      release();
+      copyFrom(other);
+    }
+    return *this;
+  }
+  Number(Number &&other) noexcept { moveFrom(other); }
+  Number &operator=(Number &&other) noexcept
+  {
+    if (this != &other) {
+      release();
+      moveFrom(other);
+    }
+    return *this;
+  }
+  ~Number() { release(); }
   // Is number a int/long/long long/float/double/long double ?
-  template<typename T> JSON_LIB_NODISCARD bool is() const { return std::get_if<T>(&jNodeNumber) != nullptr; }
-  // Did the number parse successfully (i.e. variant is not monostate)?
-  JSON_LIB_NODISCARD bool isValid() const noexcept { return !std::holds_alternative<std::monostate>(jNodeNumber); }
+  template<typename T> JSON_LIB_NODISCARD bool is() const { return jNodeType == typeOf<T>(); }
+  // Did the number parse successfully (i.e. it holds a value)?
+  JSON_LIB_NODISCARD bool isValid() const noexcept { return jNodeType != Type::none; }
   // Return numbers value int/long long/float/double/long double.
   // Note: Can still return a integer value for a floating point.
   template<typename T> JSON_LIB_NODISCARD T value() const { return getAs<T>(); }
@@ -44,15 +77,76 @@ struct Number
   template<typename T> void set(T number) { *this = Number(number); }
   // Return string representation of value
   JSON_LIB_NODISCARD std::string toString() const { return getAs<std::string>(); }
+  // Write string representation of value into buffer without allocating; returns the characters
+  // written or an empty view when they do not fit (toString() always succeeds)
+  JSON_LIB_NODISCARD std::string_view toChars(CharsBuffer &buffer) const;
   // Set floating point to string conversion parameters
    static void setPrecision(const int precision) { numberPrecision = precision; }
    static void setNotation(const numberNotation notation) { numberNotation = notation; }
 
 private:
+  // Type of value held
+  enum class Type : uint8_t { none = 0, intType, longType, longLongType, floatType, doubleType, longDoubleType };
+  // Value bytes held inline; enough for any of the types other than a long double wider than the
+  // x87 80-bit format (eg. IEEE quad), which is held in a separate allocation instead
+  static constexpr std::size_t kValueBytes{ 11 };
+  // Bytes of a long double that carry its value (the x87 format is padded out to 12 or 16 bytes)
+  static constexpr std::size_t kLongDoubleBytes{ std::numeric_limits<long double>::digits == 64 ? 10
+                                                                                              : sizeof(long double) };
+  static constexpr bool kLongDoubleInline{ kLongDoubleBytes <= kValueBytes };
+  // Long double held out of line, with the resource it was allocated from
+  struct LongDoubleBox
+  {
+    long double value;
+    std::pmr::memory_resource *resource;
+  };
+  template<typename T> static constexpr Type typeOf()
+  {
+    if constexpr (std::is_same_v<T, int>) { return Type::intType; }
+    else if constexpr (std::is_same_v<T, long>) { return Type::longType; }
+    else if constexpr (std::is_same_v<T, long long>) { return Type::longLongType; }
+    else if constexpr (std::is_same_v<T, float>) { return Type::floatType; }
+    else if constexpr (std::is_same_v<T, double>) { return Type::doubleType; }
+    else if constexpr (std::is_same_v<T, long double>) { return Type::longDoubleType; }
+    else { return Type::none; }
+  }
+  // Store/load a value of a given type (values are copied in and out so need no alignment)
+  template<typename T> void store(T value);
+  template<typename T> JSON_LIB_NODISCARD T load() const noexcept;
+  // Call visitor with the value held (std::monostate if none)
+  template<typename Visitor> decltype(auto) visitValue(Visitor &&visitor) const;
+  // Copy/move another number's value and free any long double allocation
+  void copyFrom(const Number &other)
+  {
+    if (other.jNodeType == Type::longDoubleType) {
+      store(other.load<long double>());
+    } else {
+      jNodeValue = other.jNodeValue;
+      jNodeType = other.jNodeType;
+    }
+  }
+  void moveFrom(Number &other) noexcept
+  {
+    jNodeValue = other.jNodeValue;
+    jNodeType = other.jNodeType;
+    if constexpr (!kLongDoubleInline) { other.jNodeType = Type::none; }
+  }
+  void release() noexcept
+  {
+    if constexpr (!kLongDoubleInline) {
+      if (jNodeType == Type::longDoubleType) {
+        const auto box = load<LongDoubleBox *>();
+        std::pmr::polymorphic_allocator<LongDoubleBox>{ box->resource }.delete_object(box);
+      }
+    }
+    jNodeType = Type::none;
+  }
   // Convert string to specific numeric type (returns true on success)
   template<typename T> bool stringToNumber(const std::string_view &number);
+  // Number to characters in [first, last); returns end of those written or nullptr if they do not fit
+  template<typename T> static char *numberToChars(const T &number, char *first, char *last);
   // Number to string
-  template<typename T> JSON_LIB_NODISCARD std::string numberToString(const T &number) const;
+  template<typename T> JSON_LIB_NODISCARD static std::string numberToString(const T &number);
   // Convert values to another specified type
   template<typename T, typename U> JSON_LIB_NODISCARD T convertTo(U value) const;
   // Convert values to another specified type
@@ -61,11 +155,18 @@ private:
   // integer then floating point types are tried.
   void convertNumber(const std::string_view &number)
   {
-    stringToNumber<int>(number) || stringToNumber<long>(number) || stringToNumber<long long>(number)
-      || stringToNumber<float>(number) || stringToNumber<double>(number) || stringToNumber<long double>(number);
+    Lexer lexer;
+    for (const auto ch : number) { lexer.add(ch); }
+    convertNumber(number, lexer);
+  }
+  void convertNumber(const std::string_view &number, const Lexer &lexer);
+  bool convertFloatingPoint(const std::string_view &number)
+  {
+    return stringToNumber<float>(number) || stringToNumber<double>(number) || stringToNumber<long double>(number);
   }
-  // Number values (variant)
-  Values jNodeNumber;
+  // Number value and its type (a Number is 12 bytes with no alignment requirement)
+  std::array<unsigned char, kValueBytes> jNodeValue{};
+  Type jNodeType{ Type::none };
   // Floating point to string parameters
   inline static int numberPrecision{ 6 };
   inline static auto numberNotation{ numberNotation::normal };
@@ -75,82 +176,189 @@ template<typename T> Number::Number(T value)
 {
   if constexpr (std::is_same_v<T, std::string>) {
     convertNumber(value);
+  } else if constexpr (typeOf<T>() != Type::none) {
+    store(value);
+  } else {
+    static_assert(std::is_integral_v<T> && sizeof(T) < sizeof(int), "Unsupported numeric type.");
+    store(static_cast<int>(value));
+  }
+}
+// Store a value of a given type
+template<typename T> void Number::store(const T value)
+{
+  if constexpr (std::is_same_v<T, long double>) {
+    if constexpr (kLongDoubleInline) {
+      std::memcpy(jNodeValue.data(), &value, kLongDoubleBytes);
+    } else {
+      std::pmr::polymorphic_allocator<LongDoubleBox> allocator{ detail::nodeResource() };
+      const auto box = allocator.template new_object<LongDoubleBox>(LongDoubleBox{ value, detail::nodeResource() });
+      std::memcpy(jNodeValue.data(), &box, sizeof(box));
+    }
+  } else {
+    static_assert(sizeof(T) <= kValueBytes);
+    std::memcpy(jNodeValue.data(), &value, sizeof(T));
+  }
+  jNodeType = typeOf<T>();
+}
+// Load the value held as a given type
+template<typename T> T Number::load() const noexcept
+{
+  T value{};
+  if constexpr (std::is_same_v<T, long double>) {
+    if constexpr (kLongDoubleInline) {
+      std::memcpy(&value, jNodeValue.data(), kLongDoubleBytes);
+    } else {
+      value = load<LongDoubleBox *>()->value;
+    }
+  } else {
+    std::memcpy(&value, jNodeValue.data(), sizeof(T));
+  }
+  return value;
+}
+// Call visitor with the value held
+template<typename Visitor> decltype(auto) Number::visitValue(Visitor &&visitor) const
+{
+  switch (jNodeType) {
+  case Type::intType:
+    return visitor(load<int>());
+  case Type::longType:
+    return visitor(load<long>());
+  case Type::longLongType:
+    return visitor(load<long long>());
+  case Type::floatType:
+    return visitor(load<float>());
+  case Type::doubleType:
+    return visitor(load<double>());
+  case Type::longDoubleType:
+    return visitor(load<long double>());
+  default:
+    return visitor(std::monostate{});
+  }
+}
+// Record next character of number text
+inline void Number::Lexer::add(const char ch) noexcept
+{
+  if (const auto digit = static_cast<unsigned>(ch - '0'); digit <= 9) {
+    if (shape == Shape::integer || shape == Shape::start || shape == Shape::sign) {
+      shape = Shape::integer;
+      mantissa = mantissa * 10 + digit;
+      digits++;
+    }
+  } else if (ch == '-' && shape == Shape::start) {
+    negative = true;
+    shape = Shape::sign;
+  } else if ((ch == '.' || ch == 'e' || ch == 'E' || ch == '+' || ch == '-')
+             && (shape == Shape::integer || shape == Shape::floatingPoint)) {
+    // Fraction and exponent are validated (and converted) by from_chars
+    shape = Shape::floatingPoint;
   } else {
-    jNodeNumber = value;
+    shape = Shape::other;
+  }
+}
+// Store number whose text has been through the lexer. Integers short enough to be held
+// exactly are built straight from the lexer and narrowed to the smallest type they fit;
+// floating point text skips the integer conversions and goes directly to from_chars (an
+// Eisel-Lemire conversion in the standard libraries this builds with). Types are the same
+// as the cascade of stringToNumber() conversions would pick.
+inline void Number::convertNumber(const std::string_view &number, const Lexer &lexer)
+{
+  using Shape = Lexer::Shape;
+  if (lexer.shape == Shape::integer && lexer.digits <= Lexer::kMaxExactDigits) {
+    const auto value = lexer.negative ? -static_cast<long long>(lexer.mantissa) : static_cast<long long>(lexer.mantissa);
+    if (value >= std::numeric_limits<int>::min() && value <= std::numeric_limits<int>::max()) {
+      store(static_cast<int>(value));
+    } else if (value >= std::numeric_limits<long>::min() && value <= std::numeric_limits<long>::max()) {
+      store(static_cast<long>(value));
+    } else {
+      store(value);
+    }
+  } else if (lexer.shape == Shape::floatingPoint) {
+    convertFloatingPoint(number);
+  } else {
+    stringToNumber<int>(number) || stringToNumber<long>(number) || stringToNumber<long long>(number)
+      || convertFloatingPoint(number);
   }
 }
 // Convert string to specific numeric type (returns true on success)
 template<typename T> bool Number::stringToNumber(const std::string_view &number)
 {
+  const char *first = number.data();
+  const char *last = number.data() + number.size();
+  T value{};
+  std::from_chars_result result{};
   if constexpr (std::is_same_v<T, int> || std::is_same_v<T, long> || std::is_same_v<T, long long>) {
-    T value{};
-    const auto result = std::from_chars(number.data(), number.data() + number.size(), value, kStringConversionBase);
-    if (result.ec != std::errc() || result.ptr != number.data() + number.size()) { return false; }
-    *this = Number(value);
-    return true;
+    result = std::from_chars(first, last, value, kStringConversionBase);
   } else if constexpr (std::is_floating_point_v<T>) {
-    try {
-      std::size_t end = 0;
-      T value{};
-      if constexpr (std::is_same_v<T, float>) {
-        value = std::stof(number.data(), &end);
-      } else if constexpr (std::is_same_v<T, double>) {
-        value = std::stod(number.data(), &end);
-      } else {
-        value = std::stold(number.data(), &end);
-      }
-      if (end != number.size()) { return false; }
-      *this = Number(value);
-      return true;
-    } catch (const std::exception &) {
-      return false;
-    }
+    // from_chars does not take the leading '+' that strtod style conversion allows
+    if (first != last && *first == '+') { first++; }
+    result = std::from_chars(first, last, value, std::chars_format::general);
   } else {
     static_assert(std::is_same_v<T, void>, "Unsupported numeric type.");
   }
+  if (result.ec != std::errc() || result.ptr != last) { return false; }
+  *this = Number(value);
+  return true;
 }
-// Number to string
-template<typename T> std::string Number::numberToString(const T &number) const
+// Number to characters in [first, last); returns end of those written or nullptr if they do not fit
+template<typename T> char *Number::numberToChars(const T &number, char *first, char *last)
 {
+  std::to_chars_result result{};
   if constexpr (std::is_floating_point_v<T>) {
-#if JSON_LIB_EMBEDDED
-    std::array<char, 64> buf{};
-    std::chars_format fmt = std::chars_format::general;
-    if (numberNotation == numberNotation::fixed)       fmt = std::chars_format::fixed;
-    else if (numberNotation == numberNotation::scientific) fmt = std::chars_format::scientific;
-    const auto [ptr, ec] = std::to_chars(buf.data(), buf.data() + buf.size(), number, fmt, numberPrecision);
-    std::string result(buf.data(), ptr);
-    if (result.find('.') == std::string::npos) { result += ".0"; }
-    return result;
-#else
-    std::ostringstream os;
     switch (numberNotation) {
-    case numberNotation::normal:
-      os << std::defaultfloat << std::setprecision(numberPrecision) << number;
-      break;
     case numberNotation::fixed:
-      os << std::fixed << std::setprecision(numberPrecision) << number;
+      result = std::to_chars(first, last, number, std::chars_format::fixed, numberPrecision);
       break;
     case numberNotation::scientific:
-      os << std::scientific << std::setprecision(numberPrecision) << number;
+      result = std::to_chars(first, last, number, std::chars_format::scientific, numberPrecision);
+      break;
+    case numberNotation::shortest:
+      result = std::to_chars(first, last, number);
       break;
     default:
-      os << std::setprecision(numberPrecision) << number;
+      result = std::to_chars(first, last, number, std::chars_format::general, numberPrecision);
+    }
+    if (result.ec != std::errc()) { return nullptr; }
+    // Keep floating point values distinguishable from integers. Shortest output is
+    // left alone when it has an exponent so that it stays a valid JSON number.
+    if (std::find(first, result.ptr, '.') == result.ptr
+        && (numberNotation != numberNotation::shortest || std::find(first, result.ptr, 'e') == result.ptr)) {
+      if (last - result.ptr < 2) { return nullptr; }
+      *result.ptr++ = '.';
+      *result.ptr++ = '0';
     }
-    if (os.str().find('.') == std::string::npos) { return os.str() + ".0"; }
-    return os.str();
-#endif
   } else {
-#if JSON_LIB_EMBEDDED
-    std::array<char, 32> buf{};
-    const auto [ptr, ec] = std::to_chars(buf.data(), buf.data() + buf.size(), number);
-    return std::string(buf.data(), ptr);
-#else
-    std::ostringstream os;
-    os << number;
-    return os.str();
-#endif
+    result = std::to_chars(first, last, number);
+    if (result.ec != std::errc()) { return nullptr; }
   }
+  return result.ptr;
+}
+// Number to string
+template<typename T> std::string Number::numberToString(const T &number)
+{
+  CharsBuffer buffer;
+  if (const auto end = numberToChars(number, buffer.data(), buffer.data() + buffer.size()); end != nullptr) {
+    return { buffer.data(), end };
+  }
+  // Fixed notation of large values or a high precision: room for every digit and the ".0"
+  std::string result(static_cast<std::size_t>(std::numeric_limits<long double>::max_exponent10)
+                       + static_cast<std::size_t>(std::max(numberPrecision, 0)) + 16,
+    '\0');
+  result.resize(static_cast<std::size_t>(numberToChars(number, result.data(), result.data() + result.size()) - result.data()));
+  return result;
+}
+// Write string representation of value into buffer without allocating
+inline std::string_view Number::toChars(CharsBuffer &buffer) const
+{
+  return visitValue([&](const auto &v) -> std::string_view {
+    using V = std::decay_t<decltype(v)>;
+    if constexpr (std::is_same_v<V, std::monostate>) {
+      JSON_THROW(std::runtime_error("Number Error: Could not convert unknown type."));
+    } else {
+      const auto end = numberToChars(v, buffer.data(), buffer.data() + buffer.size());
+      return end != nullptr ? std::string_view{ buffer.data(), static_cast<std::size_t>(end - buffer.data()) }
+                            : std::string_view{};
+    }
+  });
 }
 // Convert value to another specified type
 template<typename T, typename U> T Number::convertTo(U value) const
@@ -164,13 +372,13 @@ template<typename T, typename U> T Number::convertTo(U value) const
 // Convert stored number to another specified type
 template<typename T> T Number::getAs() const
 {
-  return std::visit([&](const auto &v) -> T {
+  return visitValue([&](const auto &v) -> T {
     using V = std::decay_t<decltype(v)>;
     if constexpr (std::is_same_v<V, std::monostate>) {
       JSON_THROW(std::runtime_error("Number Error: Could not convert unknown type."));
     } else {
       return convertTo<T>(v);
     }
-  }, jNodeNumber);
+  });
 }
 }// namespace JSON_Lib
\ No newline at end of file
@@ -4,8 +4,10 @@
 #include "JSON_StoragePolicy.hpp"
 #include <algorithm>
 #include <limits>
+#include <memory>
 #include <string>
 #include <string_view>
+#include <utility>
 #include <vector>
 
 namespace JSON_Lib {
@@ -13,26 +15,68 @@ namespace JSON_Lib {
 // Object entry
 struct ObjectEntry
 {
-  ObjectEntry(std::string_view key, Node &&jNode) : key(key), jNode(std::move(jNode)) {}
-  ObjectEntry(const char *key, Node &&jNode) : key(key), jNode(std::move(jNode)) {}
-  ObjectEntry(std::string &&key, Node &&jNode) : key(std::move(key)), jNode(std::move(jNode)) {}
-  JSON_LIB_NODISCARD std::string_view getKey() const { return key; }
+  ObjectEntry(std::string_view key, Node &&jNode) : jNode(std::move(jNode)), key(key, detail::nodeResource()) {}
+  ObjectEntry(const char *key, Node &&jNode) : jNode(std::move(jNode)), key(key, detail::nodeResource()) {}
+  ObjectEntry(const std::string &key, Node &&jNode) : jNode(std::move(jNode)), key(key, detail::nodeResource()) {}
+  // Key taken over from a parsed String; a key borrowed from the parser input stays borrowed
+  ObjectEntry(String &&key, Node &&jNode) : jNode(std::move(jNode))
+  {
+    if (const auto text = key.value(); key.isBorrowed()) {
+      std::construct_at(&borrowedKey, text);
+      borrowed = true;
+    } else {
+      std::construct_at(&this->key, std::move(key).release());
+    }
+  }
+  ObjectEntry(const ObjectEntry &other) = delete;
+  ObjectEntry &operator=(const ObjectEntry &other) = delete;
+  ObjectEntry(ObjectEntry &&other) noexcept : jNode(std::move(other.jNode)) { moveKey(other); }
+  ObjectEntry &operator=(ObjectEntry &&other) noexcept
+  {
+    if (this != &other) {
+      destroyKey();
+      moveKey(other);
+      jNode = std::move(other.jNode);
+    }
+    return *this;
+  }
+  ~ObjectEntry() { destroyKey(); }
+  JSON_LIB_NODISCARD std::string_view getKey() const { return borrowed ? borrowedKey : std::string_view{ key }; }
   JSON_LIB_NODISCARD Node &getNode() { return jNode; }
   JSON_LIB_NODISCARD const Node &getNode() const { return jNode; }
 
 private:
-  std::string key;
+  void moveKey(ObjectEntry &other) noexcept
+  {
+    borrowed = other.borrowed;
+    if (borrowed) {
+      std::construct_at(&borrowedKey, other.borrowedKey);
+    } else {
+      std::construct_at(&key, std::move(other.key));
+    }
+  }
+  void destroyKey() noexcept
+  {
+    if (!borrowed) { std::destroy_at(&key); }
+  }
+
   Node jNode;
+  // Owned key, or a view of parser input when strings are borrowed (see JSON::setBorrowedStrings())
+  union {
+    std::pmr::string key;
+    std::string_view borrowedKey;
+  };
+  bool borrowed{ false };
 };
 
 struct Object
 {
   using Entry = ObjectEntry;
-  using Entries = std::vector<Entry>;
+  using Entries = std::pmr::vector<Entry>;
 
   using Index = detail::ObjectIndex;
-  // Constructors/Destructors
-  Object() = default;
+  // Constructors/Destructors (storage comes from the current node memory resource)
+  Object() : jNodeObject(detail::nodeResource()), jNodeIndex(detail::nodeResource()) {}
   Object(const Object &other) = default;
   Object &operator=(const Object &other) = default;
   Object(Object &&other) = default;
@@ -41,39 +85,28 @@ struct Object
   // Add Entry to Object
   template<typename T> void add(T &&entry)
   {
-#if JSON_LIB_EMBEDDED
-    const auto key = entry.getKey();
-    if (contains(key)) { JSON_THROW(Node::Error("Duplicate key used to add object entry.")); }
-    jNodeObject.emplace_back(std::forward<T>(entry));
-    const auto insertedIndex = jNodeObject.size() - 1;
-    const auto insertPosition = std::lower_bound(
-      jNodeIndex.begin(), jNodeIndex.end(), key,
-      [this](const std::size_t lhs, const std::string_view rhs) {
-        return jNodeObject[lhs].getKey() < rhs;
-      }
-    );
-    jNodeIndex.insert(insertPosition, insertedIndex);
-#else
-    // Attempt the hash-map insert first; it detects duplicates in O(1) without
-    // a separate contains() scan.
-    const auto idx = jNodeObject.size();
-    jNodeObject.emplace_back(std::forward<T>(entry));
-    const auto [it, inserted] = jNodeIndex.emplace(jNodeObject.back().getKey(), idx);
-    if (!inserted) {
-      jNodeObject.pop_back();
-      JSON_THROW(Node::Error("Duplicate key used to add object entry."));
-    }
-#endif
+    if (!tryAdd(std::forward<T>(entry))) { JSON_THROW(Node::Error("Duplicate key used to add object entry.")); }
+  }
+  // Add Entry to Object unless its key is already present (false if it is)
+  template<typename T> JSON_LIB_NODISCARD bool tryAdd(T &&entry)
+  {
+    return findOrAdd(entry.getKey(), [&]() -> T && { return std::forward<T>(entry); }).second;
+  }
+  // Return the node for a key, adding it as a Hole if not present (true if added)
+  std::pair<Node &, bool> try_emplace(const std::string_view &key)
+  {
+    const auto [idx, added] = findOrAdd(key, [&] { return Entry(key, Node::make<Hole>()); });
+    return { jNodeObject[idx].getNode(), added };
   }
   // Return true if an object contains a given key
   JSON_LIB_NODISCARD bool contains(const std::string_view &key) const { return lookupKey(key) != npos; }
   // Return number of entries in an object
   JSON_LIB_NODISCARD int size() const { return static_cast<int>(jNodeObject.size()); }
-  // Reserve storage for object entries and index buckets
+  // Reserve storage for object entries (and index buckets when the object will be indexed)
   void reserve(const std::size_t capacity)
   {
     jNodeObject.reserve(capacity);
-    jNodeIndex.reserve(capacity);
+    if (capacity > detail::kObjectLinearScanEntries) { jNodeIndex.reserve(capacity); }
   }
   // Return object entry for a given key
   Node &operator[](const std::string_view &key) { return jNodeObject[getIndex(key)].getNode(); }
@@ -92,14 +125,21 @@ struct Object
   // Return reference to base of object entries
   Entries &value() { return jNodeObject; }
   JSON_LIB_NODISCARD const Entries &value() const { return jNodeObject; }
+  // Memory resource object storage is allocated from
+  JSON_LIB_NODISCARD std::pmr::memory_resource *resource() const noexcept
+  {
+    return jNodeObject.get_allocator().resource();
+  }
 
 private:
   // Sentinel for "key not found"
   static constexpr std::size_t npos = std::numeric_limits<std::size_t>::max();
 
-  // Single unified key-to-index lookup; returns npos when not found.
+  // Single unified key-to-index lookup; returns npos when not found. Objects too small
+  // to have an index are scanned.
   JSON_LIB_NODISCARD std::size_t lookupKey(const std::string_view &key) const
   {
+    if (jNodeIndex.empty()) { return scanKey(key); }
 #if JSON_LIB_EMBEDDED
     const auto it = std::lower_bound(
       jNodeIndex.begin(), jNodeIndex.end(), key,
@@ -110,9 +150,67 @@ private:
     if (it != jNodeIndex.end() && jNodeObject[*it].getKey() == key) { return *it; }
     return npos;
 #else
-    const auto it = jNodeIndex.find(key);
-    return it != jNodeIndex.end() ? it->second : npos;
+    return jNodeIndex.find(detail::hashKey(key), [&](const std::size_t idx) { return jNodeObject[idx].getKey() == key; });
+#endif
+  }
+
+  JSON_LIB_NODISCARD std::size_t scanKey(const std::string_view &key) const
+  {
+    for (std::size_t idx = 0; idx < jNodeObject.size(); idx++) {
+      if (jNodeObject[idx].getKey() == key) { return idx; }
+    }
+    return npos;
+  }
+
+  // Position of the entry for a key, adding the one makeEntry() returns if there is none
+  // (true if added). The key is hashed and the index probed once whichever happens.
+  template<typename MakeEntry>
+  std::pair<std::size_t, bool> findOrAdd(const std::string_view &key, MakeEntry &&makeEntry)
+  {
+    if (jNodeIndex.empty()) {
+      if (const auto idx = scanKey(key); idx != npos) { return { idx, false }; }
+      jNodeObject.emplace_back(makeEntry());
+      if (jNodeObject.size() > detail::kObjectLinearScanEntries) { buildIndex(); }
+      return { jNodeObject.size() - 1, true };
+    }
+#if JSON_LIB_EMBEDDED
+    const auto it = std::lower_bound(
+      jNodeIndex.begin(), jNodeIndex.end(), key,
+      [this](const std::size_t lhs, const std::string_view rhs) {
+        return jNodeObject[lhs].getKey() < rhs;
+      }
+    );
+    if (it != jNodeIndex.end() && jNodeObject[*it].getKey() == key) { return { *it, false }; }
+    const auto insertPosition = it - jNodeIndex.begin();
+    jNodeObject.emplace_back(makeEntry());
+    jNodeIndex.insert(jNodeIndex.begin() + insertPosition, jNodeObject.size() - 1);
+#else
+    const auto probe =
+      jNodeIndex.probe(detail::hashKey(key), [&](const std::size_t idx) { return jNodeObject[idx].getKey() == key; });
+    if (probe.position != npos) { return { probe.position, false }; }
+    jNodeObject.emplace_back(makeEntry());
+    jNodeIndex.insert(probe, jNodeObject.size() - 1);
 #endif
+    return { jNodeObject.size() - 1, true };
+  }
+
+  // Index every entry; done the first time the object grows past the linear scan size
+  void buildIndex()
+  {
+    jNodeIndex.reserve(jNodeObject.size());
+    for (std::size_t idx = 0; idx < jNodeObject.size(); idx++) {
+#if JSON_LIB_EMBEDDED
+      const auto insertPosition = std::lower_bound(
+        jNodeIndex.begin(), jNodeIndex.end(), jNodeObject[idx].getKey(),
+        [this](const std::size_t lhs, const std::string_view rhs) {
+          return jNodeObject[lhs].getKey() < rhs;
+        }
+      );
+      jNodeIndex.insert(insertPosition, idx);
+#else
+      jNodeIndex.insert(detail::hashKey(jNodeObject[idx].getKey()), idx);
+#endif
+    }
   }
 
   JSON_LIB_NODISCARD std::size_t getIndex(const std::string_view &key) const
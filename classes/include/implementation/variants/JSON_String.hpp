@@ -1,8 +1,11 @@
 #pragma once
 
+#include <algorithm>
+#include <memory>
 #include <string>
 #include <string_view>
 #include "JSON_Config.hpp"
+#include "JSON_Arena.hpp"
 
 namespace JSON_Lib {
 
@@ -16,41 +19,144 @@ struct String
   constexpr static int64_t kDefMaxStringLength = 16*1024;
 #endif
   // Constructors/Destructors
-  String() : m_maxStringLength(g_defaultStringLength ? g_defaultStringLength : kDefMaxStringLength) {}
-  explicit String(const std::string_view &string)
-    : jNodeString(string), m_maxStringLength(g_defaultStringLength ? g_defaultStringLength : kDefMaxStringLength)
-  {}
+  String() : String(std::string_view{}, defaultMaxStringLength()) {}
+  explicit String(const std::string_view &string) : String(string, defaultMaxStringLength()) {}
   String(const std::string_view &string, const uint64_t maxStringLength)
-    : jNodeString(string), m_maxStringLength(maxStringLength)
-  {}
-  explicit String(const uint64_t maxStringLength)
-    : m_maxStringLength(maxStringLength)
-  {}
-  String(const String &other) = default;
-  String &operator=(const String &other) = default;
-  String(String &&other) = default;
-  String &operator=(String &&other) = default;
-  ~String() = default;
+    : m_maxStringLength(std::min(maxStringLength, kMaxStringLengthLimit))
+  {
+    std::construct_at(&jNodeStorage.owned, string, detail::nodeResource());
+  }
+  explicit String(const uint64_t maxStringLength) : String(std::string_view{}, maxStringLength) {}
+  // Copies always own their text (from the default resource, as a std::pmr::string copy would)
+  String(const String &other) : m_maxStringLength(other.m_maxStringLength)
+  {
+    std::construct_at(&jNodeStorage.owned, other.value());
+  }
+  String &operator=(const String &other)
+  {
+    if (this != &other) {
+      const auto text = other.value();
+      if (m_borrowed) {
+        adopt(text);
+      } else {
+        jNodeStorage.owned.assign(text);
+      }
+      m_maxStringLength = other.m_maxStringLength;
+    }
+    return *this;
+  }
+  String(String &&other) noexcept { moveFrom(other, other.resource()); }
+  // Move assignment keeps the string's own memory resource (as a std::pmr::string would)
+  String &operator=(String &&other) noexcept
+  {
+    if (this != &other) {
+      auto *const resource = this->resource();
+      destroy();
+      moveFrom(other, resource);
+    }
+    return *this;
+  }
+  ~String() { destroy(); }
+  // String referencing text that must outlive it rather than holding a copy (see
+  // JSON::setBorrowedStrings()). The text is used as is, so it must hold no escapes.
+  JSON_LIB_NODISCARD static String borrow(const std::string_view &text)
+  {
+    return String{ Borrowed{ text, detail::nodeResource() } };
+  }
+  // Does the string still reference text it does not own
+  JSON_LIB_NODISCARD bool isBorrowed() const noexcept { return m_borrowed; }
+  // Memory resource the string's text is (or will be when owned) allocated from
+  JSON_LIB_NODISCARD std::pmr::memory_resource *resource() const noexcept
+  {
+    return m_borrowed ? jNodeStorage.borrowed.resource : jNodeStorage.owned.get_allocator().resource();
+  }
   // Return reference to string
-  JSON_LIB_NODISCARD std::string_view value() { return jNodeString; }
-  JSON_LIB_NODISCARD std::string_view value() const { return jNodeString; }
+  JSON_LIB_NODISCARD std::string_view value() { return view(); }
+  JSON_LIB_NODISCARD std::string_view value() const { return view(); }
   // Return string representation of value
-  JSON_LIB_NODISCARD const std::string &toString() const noexcept { return jNodeString; }
-  JSON_LIB_NODISCARD std::string_view toStringView() const noexcept { return jNodeString; }
+  JSON_LIB_NODISCARD std::string toString() const { return std::string{ view() }; }
+  JSON_LIB_NODISCARD std::string_view toStringView() const noexcept { return view(); }
   // Append and reserve helpers for parser string extraction
-  void reserve(const std::size_t capacity) { jNodeString.reserve(capacity); }
-  void append(char ch) { jNodeString.push_back(ch); }
-  void append(const std::string_view &value) { jNodeString.append(value); }
-  void pop_back() { jNodeString.pop_back(); }
-  void clear() { jNodeString.clear(); }
-  JSON_LIB_NODISCARD std::size_t size() const noexcept { return jNodeString.size(); }
-  // Set/get maximum string length
-  void setMaxStringLength(const uint64_t length) { m_maxStringLength = length; }
+  void reserve(const std::size_t capacity) { own().reserve(capacity); }
+  void append(char ch) { own().push_back(ch); }
+  void append(const std::string_view &value) { own().append(value); }
+  void pop_back() { own().pop_back(); }
+  void clear() { own().clear(); }
+  JSON_LIB_NODISCARD std::size_t size() const noexcept { return view().size(); }
+  // Give up owned text (borrowed text is copied)
+  JSON_LIB_NODISCARD std::pmr::string release() &&
+  {
+    if (m_borrowed) { return std::pmr::string{ jNodeStorage.borrowed.text, jNodeStorage.borrowed.resource }; }
+    return std::move(jNodeStorage.owned);
+  }
+  // Set/get maximum string length (lengths beyond 2^63 - 1 are clamped to it)
+  void setMaxStringLength(const uint64_t length) { m_maxStringLength = std::min(length, kMaxStringLengthLimit); }
   JSON_LIB_NODISCARD uint64_t getMaxStringLength() const noexcept { return m_maxStringLength; }
 
 private:
-  std::string jNodeString;
-  uint64_t m_maxStringLength{ g_defaultStringLength ? g_defaultStringLength : kDefMaxStringLength };
+  // Largest maximum length storable alongside the borrowed flag
+  constexpr static uint64_t kMaxStringLengthLimit = (uint64_t{ 1 } << 63) - 1;
+  // Input text referenced by a borrowed string
+  struct Borrowed
+  {
+    std::string_view text;
+    std::pmr::memory_resource *resource;
+  };
+  // Owned text is allocated from the node memory resource current when the string was created;
+  // borrowed text shares the space so that a String (and so a Node) is no bigger for it.
+  union Storage {
+    Storage() noexcept {}
+    ~Storage() {}
+    std::pmr::string owned;
+    Borrowed borrowed;
+  };
+
+  explicit String(const Borrowed &borrowed) : m_maxStringLength(defaultMaxStringLength()), m_borrowed(true)
+  {
+    std::construct_at(&jNodeStorage.borrowed, borrowed);
+  }
+  static uint64_t defaultMaxStringLength() noexcept
+  {
+    return std::min<uint64_t>(g_defaultStringLength ? g_defaultStringLength : kDefMaxStringLength, kMaxStringLengthLimit);
+  }
+  void moveFrom(String &other, std::pmr::memory_resource *resource) noexcept
+  {
+    m_maxStringLength = other.m_maxStringLength;
+    m_borrowed = other.m_borrowed;
+    if (m_borrowed) {
+      std::construct_at(&jNodeStorage.borrowed, other.jNodeStorage.borrowed);
+      jNodeStorage.borrowed.resource = resource;
+    } else {
+      std::construct_at(&jNodeStorage.owned, std::move(other.jNodeStorage.owned), resource);
+    }
+  }
+  void destroy() noexcept
+  {
+    if (!m_borrowed) { std::destroy_at(&jNodeStorage.owned); }
+  }
+  // Switch a borrowed string over to owning text, allocated from the resource it was created with
+  void adopt(const std::string_view &text)
+  {
+    std::pmr::string owned{ text, jNodeStorage.borrowed.resource };
+    std::construct_at(&jNodeStorage.owned, std::move(owned));
+    m_borrowed = false;
+  }
+  // Text of the string (reading never modifies it, so a tree can be read from several threads)
+  std::string_view view() const noexcept
+  {
+    return m_borrowed ? jNodeStorage.borrowed.text : std::string_view{ jNodeStorage.owned };
+  }
+  // Owned text ready for modification
+  std::pmr::string &own()
+  {
+    if (m_borrowed) { adopt(jNodeStorage.borrowed.text); }
+    return jNodeStorage.owned;
+  }
+
+  Storage jNodeStorage;
+  // Maximum length and borrowed flag share a word to keep String (and so Node) small
+  uint64_t m_maxStringLength : 63 {};
+  uint64_t m_borrowed : 1 {};
 };
 
 inline uint64_t g_defaultStringLength = String::kDefMaxStringLength;
@@ -58,4 +164,4 @@ inline uint64_t g_defaultStringLength = String::kDefMaxStringLength;
 inline void setDefaultStringLength(const uint64_t length) { g_defaultStringLength = length; }
 inline uint64_t getDefaultStringLength() noexcept { return g_defaultStringLength; }
 
-}// namespace JSON_Lib
\ No newline at end of file
+}// namespace JSON_Lib
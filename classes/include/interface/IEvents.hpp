@@ -0,0 +1,78 @@
+#pragma once
+
+#include <string_view>
+#include "JSON_ErrorBase.hpp"
+
+namespace JSON_Lib {
+
+// ====================
+// Forward declarations
+// ====================
+struct Number;
+
+// ====================================================
+// Interface for the events raised while JSON is parsed
+// ====================================================
+/// @brief Callback interface driven directly by the parser as it reads JSON.
+///
+/// Unlike IAction, which walks a tree after it has been built, the events
+/// arrive while the source is being read and no Node tree is created, so
+/// memory use is bounded by the nesting depth rather than the document
+/// size.  Default implementations are no-ops.  Throwing from a callback
+/// abandons the parse and the exception propagates to the caller.
+///
+/// ## Event contract
+///
+/// Events arrive in document order.  Each object entry raises `onKey`
+/// followed by the events of its value; every `onObjectStart` and
+/// `onArrayStart` is matched by an `onObjectEnd` or `onArrayEnd`.
+/// Strings and keys have had their escapes decoded.  The views passed to
+/// `onKey` and `onString` are only valid for the duration of the call.
+/// A key repeated within an object is passed on rather than rejected as
+/// it is when a tree is built (that would mean holding every key).
+///
+/// Example call sequence for `{ "x": [1, "a"] }`:
+/// @code
+///   onObjectStart()
+///     onKey("x")
+///     onArrayStart()
+///       onNumber(1)
+///       onString("a")
+///     onArrayEnd()
+///   onObjectEnd()
+/// @endcode
+class IEvents
+{
+public:
+  /// @brief Exception type thrown by IEvents implementations.
+  struct Error final : std::runtime_error
+  {
+    explicit Error(const std::string_view &message) : std::runtime_error(makeTaggedError("IEvents", message)) {}
+  };
+  virtual ~IEvents() = default;
+
+  /// @brief Called on the opening '{' of an object.
+  virtual void onObjectStart() {}
+  /// @brief Called on the closing '}' of an object.
+  virtual void onObjectEnd() {}
+  /// @brief Called on the opening '[' of an array.
+  virtual void onArrayStart() {}
+  /// @brief Called on the closing ']' of an array.
+  virtual void onArrayEnd() {}
+
+  /// @brief Called with the key of each object entry, before the events of its value.
+  /// @param key Decoded key (valid only during the call).
+  virtual void onKey(const std::string_view &/*key*/) {}
+  /// @brief Called for a string value.
+  /// @param value Decoded string (valid only during the call).
+  virtual void onString(const std::string_view &/*value*/) {}
+  /// @brief Called for a numeric value.
+  /// @param value Number stored in the smallest type that holds it.
+  virtual void onNumber(const Number &/*value*/) {}
+  /// @brief Called for a boolean value.
+  /// @param value @c true or @c false.
+  virtual void onBoolean(bool /*value*/) {}
+  /// @brief Called for a null value.
+  virtual void onNull() {}
+};
+}// namespace JSON_Lib
@@ -10,6 +10,7 @@ namespace JSON_Lib {
 // ====================
 
 class ISource;
+class IEvents;
 struct Node;
 
 // =========================
@@ -43,6 +44,15 @@ public:
   /// @return A Result containing the root Node on success, or an error status.
   virtual Result<Node> parseResult(ISource &source);
 
+  /// @brief Parse JSON from @p source raising an event for each value rather than building a tree.
+  ///
+  /// The default implementation calls @c parse() and then raises the events
+  /// for the finished tree.  Override to raise them while the source is read.
+  /// @param source The input stream to read from.
+  /// @param events Callbacks to raise.
+  /// @throws IParser::Error on malformed input.
+  virtual void parseEvents(ISource &source, IEvents &events);
+
   /// @brief Set the maximum recursion depth for this parser instance.
   /// @param depth Maximum nesting depth; zero restores the compile-time default.
   virtual void setMaxParserDepth(unsigned long /*depth*/) {}
@@ -50,5 +60,16 @@ public:
   /// @brief Return the maximum recursion depth for this parser instance.
   /// @return Current maximum depth (default: compile-time @c kDefaultMaxParserDepth).
   virtual unsigned long getMaxParserDepth() const noexcept { return 0; }
+
+  /// @brief Let strings and object keys parsed from contiguous sources reference the source bytes.
+  ///
+  /// The bytes must then outlive the parsed tree.  Escaped strings are decoded
+  /// the first time they are read.  Parsers that always copy ignore this (the default).
+  /// @param borrow @c true to borrow strings rather than copy them.
+  virtual void setBorrowedStrings(bool /*borrow*/) {}
+
+  /// @brief Return whether strings are borrowed from contiguous sources.
+  /// @return @c true if parsed strings reference the source bytes.
+  virtual bool getBorrowedStrings() const noexcept { return false; }
 };
 }// namespace JSON_Lib
\ No newline at end of file
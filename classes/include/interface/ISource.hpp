@@ -1,5 +1,7 @@
 #pragma once
 
+#include <algorithm>
+#include <memory>
 #include <string_view>
 #include <utility>
 #include "implementation/common/JSON_Attributes.hpp"
@@ -13,6 +15,25 @@ namespace JSON_Lib {
 constexpr char kCarriageReturn{ 0x0D };
 constexpr char kLineFeed{ 0x0A };
 
+// ==================================================================
+// Line/column reached after stepping onto each character of "landed"
+// in turn from "position"; mirrors the bookkeeping in ISource::next().
+// "steps" may exceed landed.size() by one when the last step moves
+// onto end of stream.
+// ==================================================================
+inline std::pair<long, long>
+  advancePosition(std::pair<long, long> position, const std::string_view &landed, const std::size_t steps)
+{
+  const auto lastLineFeed = landed.rfind(kLineFeed);
+  if (lastLineFeed == std::string_view::npos) {
+    position.second += static_cast<long>(steps);
+    return position;
+  }
+  position.first += static_cast<long>(std::count(landed.begin(), landed.begin() + lastLineFeed + 1, kLineFeed));
+  position.second = static_cast<long>(steps - lastLineFeed);
+  return position;
+}
+
 // =======================================================
 // Interface for reading source stream during JSON parsing
 // =======================================================
@@ -44,6 +65,57 @@ public:
   /// @brief Reset the read position to the beginning of the stream.
   virtual void reset() = 0;
 
+  /// @brief Return the unread remainder of the stream when it is held in contiguous memory.
+  ///
+  /// Buffer-backed sources override this so that the parser can scan the bytes
+  /// directly rather than calling current()/next() per character.  Sources that
+  /// cannot expose such a span return an empty view (the default).
+  /// @return View from the current position to the end of the stream.
+  JSON_LIB_NODISCARD virtual std::string_view contiguous() const JSON_LIB_NOEXCEPT { return {}; }
+
+  /// @brief Advance the read position by @p length characters.
+  ///
+  /// Equivalent to calling next() @p length times; contiguous sources override
+  /// it to move in one step and bring the line/column numbers up to date in bulk.
+  /// @param length Number of characters to advance.
+  virtual void advance(std::size_t length)
+  {
+    while (length-- > 0) { next(); }
+  }
+
+  /// @brief Copy up to @p length characters from the read position into @p bytes and advance past them.
+  ///
+  /// Lets a consumer that needs only the characters (such as whitespace
+  /// stripping) take them a block at a time.  The default copies from
+  /// contiguous() when that is available and otherwise steps through
+  /// current()/next(); sources backed by a stream override it to read in bulk.
+  /// @param bytes Destination for the characters.
+  /// @param length Maximum number of characters to copy.
+  /// @return Number of characters copied (zero once the stream is exhausted).
+  virtual std::size_t read(char *bytes, const std::size_t length)
+  {
+    if (const auto span = contiguous(); !span.empty()) {
+      const auto count = std::min(length, span.size());
+      std::copy_n(span.data(), count, bytes);
+      advance(count);
+      return count;
+    }
+    std::size_t count = 0;
+    for (; count < length && more(); count++) {
+      bytes[count] = current();
+      next();
+    }
+    return count;
+  }
+
+  /// @brief Share ownership of the bytes returned by contiguous().
+  ///
+  /// Lets a tree whose strings reference the source bytes keep them alive once
+  /// the source itself has gone.  Sources that do not own their bytes return
+  /// null (the default); the caller must then keep the bytes alive itself.
+  /// @return Owner of the contiguous bytes, or null.
+  JSON_LIB_NODISCARD virtual std::shared_ptr<const void> shareBuffer() { return nullptr; }
+
   /// @brief Return the current byte offset within the source stream.
   /// @return Zero-based byte position of the current character.
   JSON_LIB_NODISCARD virtual std::size_t position() const = 0;
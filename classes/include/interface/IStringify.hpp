@@ -42,6 +42,14 @@ public:
   /// @brief Set the pretty-print indentation step.
   /// @param indent Number of spaces per indent level; must be >= 0.
   virtual void setIndent(long indent) {}
+
+  /// @brief Return the character pretty-print indentation is made of.
+  /// @return Space or tab; space if not applicable.
+  JSON_LIB_NODISCARD virtual char getIndentCharacter() const JSON_LIB_NOEXCEPT { return ' '; }
+
+  /// @brief Set the character pretty-print indentation is made of.
+  /// @param indentCharacter Space or tab; the indentation step counts these characters.
+  virtual void setIndentCharacter(char /*indentCharacter*/) {}
 };
 
 /// @brief Factory helper: create a @c std::unique_ptr<IStringify> of type @p T.
@@ -1,7 +1,9 @@
 #pragma once
 
+#include "JSON_Config.hpp"
 #include "implementation/common/JSON_Attributes.hpp"
 #include "JSON_ErrorBase.hpp"
+#include "IDestination.hpp"
 
 namespace JSON_Lib {
 
@@ -31,6 +33,37 @@ public:
   /// @throws ITranslator::Error on malformed escape sequences.
   JSON_LIB_NODISCARD virtual std::string from(const std::string_view &escapedString) const = 0;
 
+  /// @brief Message reported by tryFrom() for an escape that decodes to a null
+  /// character, which from() throws as a JSON_Lib::Error rather than an ITranslator::Error.
+  static constexpr std::string_view kNullCharacter{ "Tried to convert a null character." };
+
+  /// @brief Convert a JSON-escaped string to raw UTF-8 without throwing on malformed escapes.
+  ///
+  /// Used by the parser entry points that report errors without exceptions.
+  /// The default calls from() and turns an ITranslator::Error into a generic
+  /// message; implementations may override it to decode without throwing.
+  /// @param escapedString A string that may contain JSON escape sequences.
+  /// @param unescaped Receives the decoded UTF-8 string on success.
+  /// @param message Receives the error message (a string literal) on failure.
+  /// @return @c true on success, @c false on a malformed escape sequence.
+  JSON_LIB_NODISCARD virtual bool
+    tryFrom(const std::string_view &escapedString, std::string &unescaped, const char *&message) const
+  {
+#if JSON_LIB_NO_EXCEPTIONS
+    (void)message;
+    unescaped = from(escapedString);
+    return true;
+#else
+    try {
+      unescaped = from(escapedString);
+      return true;
+    } catch (const Error &) {
+      message = "Invalid escape sequence in string.";
+      return false;
+    }
+#endif
+  }
+
   /// @brief Convert a raw UTF-8 string to its JSON-escaped representation.
   ///
   /// Replaces characters that must be escaped in JSON (e.g. @c \", @c \\,
@@ -39,5 +72,18 @@ public:
   /// @return The JSON-escaped string, suitable for embedding inside JSON quotes.
   /// @throws ITranslator::Error on invalid UTF-8 input.
   JSON_LIB_NODISCARD virtual std::string to(const std::string_view &rawString) const = 0;
+
+  /// @brief Append the JSON-escaped representation of a raw UTF-8 string to a destination.
+  ///
+  /// Used by the stringifiers. The default implementation adds the result of
+  /// to(); implementations may override it to write unchanged runs of the
+  /// input straight to the destination instead of building a new string.
+  /// @param rawString A raw UTF-8 string.
+  /// @param destination Destination for the escaped string.
+  /// @throws ITranslator::Error on invalid UTF-8 input.
+  virtual void addTo(const std::string_view &rawString, IDestination &destination) const
+  {
+    destination.add(to(rawString));
+  }
 };
 }// namespace JSON_Lib
\ No newline at end of file
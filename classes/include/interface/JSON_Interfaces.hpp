@@ -1,6 +1,7 @@
 #pragma once
 
 #include "IAction.hpp"
+#include "IEvents.hpp"
 #include "IDestination.hpp"
 #include "ISource.hpp"
 #include "ITranslator.hpp"
@@ -68,10 +68,23 @@ std::string JSON::version() { return JSON_Impl::version(); }
 /// </summary>
 /// <param name="source">Source of JSON.</param>
 /// <param name="destination">Destination for stripped JSON.</param>
-void JSON::strip(ISource &source, IDestination &destination) { JSON_Impl::strip(source, destination); }
-void JSON::strip(ISource &source, IDestination &&destination)  { JSON_Impl::strip(source, destination); }
-void JSON::strip(ISource &&source, IDestination &destination)  { JSON_Impl::strip(source, destination); }
-void JSON::strip(ISource &&source, IDestination &&destination)  { JSON_Impl::strip(source, destination); }
+/// <param name="validate">==true then check the JSON is well-formed first.</param>
+void JSON::strip(ISource &source, IDestination &destination, const bool validate)
+{
+  JSON_Impl::strip(source, destination, validate);
+}
+void JSON::strip(ISource &source, IDestination &&destination, const bool validate)
+{
+  JSON_Impl::strip(source, destination, validate);
+}
+void JSON::strip(ISource &&source, IDestination &destination, const bool validate)
+{
+  JSON_Impl::strip(source, destination, validate);
+}
+void JSON::strip(ISource &&source, IDestination &&destination, const bool validate)
+{
+  JSON_Impl::strip(source, destination, validate);
+}
 /// <summary>
 /// Create Node structure by parsing JSON on the source stream.
 /// </summary>
@@ -81,6 +94,16 @@ void JSON::parse(ISource &&source) { implementation->parse(source); }
 Result<Node> JSON::parseResult(ISource &source) { return implementation->parseResult(source); }
 Result<Node> JSON::parseResult(ISource &&source) { return implementation->parseResult(source); }
 /// <summary>
+/// Parse JSON on the source stream raising events as it is read; no Node tree
+/// is built and the current one is left as it is.
+/// </summary>
+/// <param name="source">Source for JSON encoded bytes.</param>
+/// <param name="events">Callbacks to raise.</param>
+void JSON::parse(ISource &source, IEvents &events) { implementation->parse(source, events); }
+void JSON::parse(ISource &&source, IEvents &events) { implementation->parse(source, events); }
+Result<void> JSON::parseResult(ISource &source, IEvents &events) { return implementation->parseResult(source, events); }
+Result<void> JSON::parseResult(ISource &&source, IEvents &events) { return implementation->parseResult(source, events); }
+/// <summary>
 /// Traverse Node structure and build its JSON string (no whitespace) on destination stream.
 /// </summary>
 /// <param name="destination">Destination stream for stringified JSON.</param>
@@ -101,8 +124,18 @@ Result<void> JSON::printResult(IDestination &&destination) const { return implem
 /// </summary>
 /// <param name="indent">Pretty print indent value.</param>
 void JSON::setIndent(const long indent) { implementation->setIndent(indent); }
+/// <summary>
+/// Set/get print indent character (space or tab).
+/// </summary>
+/// <param name="indentCharacter">Pretty print indent character.</param>
+void JSON::setIndentCharacter(const char indentCharacter) { implementation->setIndentCharacter(indentCharacter); }
+char JSON::getIndentCharacter() const noexcept { return implementation->getIndentCharacter(); }
 void JSON::setMaxParserDepth(const unsigned long depth) { implementation->setMaxParserDepth(depth); }
 unsigned long JSON::getMaxParserDepth() const noexcept { return implementation->getMaxParserDepth(); }
+void JSON::setArenaMode(const bool enabled) { implementation->setArenaMode(enabled); }
+bool JSON::getArenaMode() const noexcept { return implementation->getArenaMode(); }
+void JSON::setBorrowedStrings(const bool borrow) { implementation->setBorrowedStrings(borrow); }
+bool JSON::getBorrowedStrings() const noexcept { return implementation->getBorrowedStrings(); }
 /// <summary>
 /// Recursively traverse Node structure calling IAction methods (read-only)
 ///  or to change the JSON tree node directly.
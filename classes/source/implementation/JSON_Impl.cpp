@@ -8,6 +8,7 @@
 
 #include "JSON_Impl.hpp"
 #include "JSON_Throw.hpp"
+#include <algorithm>
 #include <string>
 
 namespace JSON_Lib {
@@ -32,6 +33,8 @@ void JSON_Impl::setIndent(const long indent)
 }
 void JSON_Impl::setMaxParserDepth(const unsigned long depth) { jsonParser->setMaxParserDepth(depth); }
 unsigned long JSON_Impl::getMaxParserDepth() const noexcept { return jsonParser->getMaxParserDepth(); }
+void JSON_Impl::setBorrowedStrings(const bool borrow) { jsonParser->setBorrowedStrings(borrow); }
+bool JSON_Impl::getBorrowedStrings() const noexcept { return jsonParser->getBorrowedStrings(); }
 std::string JSON_Impl::version()
 {
   std::string v;
@@ -42,13 +45,85 @@ std::string JSON_Impl::version()
    .append(std::to_string(JSON_VERSION_PATCH));
   return v;
 }
-void JSON_Impl::parse(ISource &source) { jNodeRoot = jsonParser->parse(source); }
+/// <summary>
+/// Create the arena for parsing a source. Its first block is sized from the
+/// unread input when that is known and it grows geometrically from there.
+/// </summary>
+/// <param name="source">Source of JSON.</param>
+/// <returns>Arena memory resource.</returns>
+std::unique_ptr<std::pmr::monotonic_buffer_resource> JSON_Impl::makeArena(ISource &source)
+{
+  static constexpr std::size_t kMinArenaBlockSize = 64 * 1024;
+  return std::make_unique<std::pmr::monotonic_buffer_resource>(
+    std::max(kMinArenaBlockSize, source.contiguous().size()));
+}
+/// <summary>
+/// Release the current tree. A tree built wholly in the arena, that has not
+/// been handed out for modification since, is simply abandoned as its storage
+/// goes when the arena does; otherwise its nodes are destroyed individually.
+/// </summary>
+void JSON_Impl::releaseTree() noexcept
+{
+  if (bulkRelease) {
+    std::construct_at(&jNodeRoot);
+  } else {
+    jNodeRoot = Node{};
+  }
+  bulkRelease = false;
+}
+/// <summary>
+/// Replace the current tree (and the arena and input it references) with a newly parsed one.
+/// </summary>
+/// <param name="parsed">Newly parsed tree.</param>
+/// <param name="arena">Arena it was allocated from (null if none).</param>
+/// <param name="input">Source bytes its borrowed strings reference (null if none or not shareable).</param>
+void JSON_Impl::adoptTree(Node &&parsed,
+  std::unique_ptr<std::pmr::monotonic_buffer_resource> &&arena,
+  std::shared_ptr<const void> &&input) noexcept
+{
+  releaseTree();
+  jNodeRoot = std::move(parsed);
+  jsonArena = std::move(arena);
+  jsonInput = std::move(input);
+  bulkRelease = jsonArena != nullptr;
+}
+void JSON_Impl::parse(ISource &source)
+{
+  auto arena = arenaMode ? makeArena(source) : nullptr;
+  auto input = jsonParser->getBorrowedStrings() ? source.shareBuffer() : nullptr;
+  Node parsed;
+  {
+    // Without an arena the scope just keeps the thread's current node resource
+    const detail::ScopedNodeResource scope{ arena ? arena.get() : detail::currentNodeResource() };
+    parsed = jsonParser->parse(source);
+  }
+  adoptTree(std::move(parsed), std::move(arena), std::move(input));
+}
 Result<Node> JSON_Impl::parseResult(ISource &source)
 {
-  auto result = jsonParser->parseResult(source);
-  if (result.ok() && result.value) { jNodeRoot = std::move(*result.value); }
+  auto arena = arenaMode ? makeArena(source) : nullptr;
+  auto input = jsonParser->getBorrowedStrings() ? source.shareBuffer() : nullptr;
+  auto result = [&] {
+    const detail::ScopedNodeResource scope{ arena ? arena.get() : detail::currentNodeResource() };
+    return jsonParser->parseResult(source);
+  }();
+  if (result.ok() && result.value) { adoptTree(std::move(*result.value), std::move(arena), std::move(input)); }
   return result;
 }
+void JSON_Impl::parse(ISource &source, IEvents &events) { jsonParser->parseEvents(source, events); }
+Result<void> JSON_Impl::parseResult(ISource &source, IEvents &events)
+{
+  try {
+    jsonParser->parseEvents(source, events);
+    return { Status::Ok, {}, { 0, 0 } };
+  } catch (const SyntaxError &ex) {
+    return { Status::SyntaxError, ex.what(), source.getPosition() };
+  } catch (const std::exception &ex) {
+    return { Status::UnknownError, ex.what(), source.getPosition() };
+  } catch (...) {
+    return { Status::UnknownError, "Unknown exception during parse.", source.getPosition() };
+  }
+}
 void JSON_Impl::stringify(IDestination &destination) const
 {
   if (jNodeRoot.isEmpty()) { JSON_THROW(Error("No JSON to stringify.")); }
@@ -81,29 +156,9 @@ Result<void> JSON_Impl::printResult(IDestination &destination) const
 {
   return runStringify(destination, jsonStringify->getIndent());
 }
-void JSON_Impl::strip(ISource &source, IDestination &destination)
-{// Note: That it is assumed that the JSON on the source stream is valid with no errors.
-  while (source.more()) {
-    if (!source.isWS()) {
-      destination.add(source.current());
-      if (source.current() == '"') {
-        source.next();
-        while (source.more() && source.current() != '"') {
-          if (source.current() == '\\') {
-            destination.add(source.current());
-            source.next();
-          }
-          destination.add(source.current());
-          source.next();
-        }
-        destination.add(source.current());
-      }
-    }
-    source.next();
-  }
-}
 void JSON_Impl::traverse(IAction &action)
 {
+  bulkRelease = false;
   if (jNodeRoot.isEmpty()) { JSON_THROW(Error("No JSON to traverse.")); }
   traverseNodes(jNodeRoot, action);
 }
@@ -114,6 +169,7 @@ void JSON_Impl::traverse(IAction &action) const
 }
 Result<void> JSON_Impl::runTraverse(IAction &action)
 {
+  bulkRelease = false;
   if (jNodeRoot.isEmpty()) {
     return {Status::InvalidInput, {}, {0, 0}};
   }
@@ -142,17 +198,13 @@ Result<void> JSON_Impl::runTraverse(IAction &action) const
 }
 Node &JSON_Impl::operator[](const std::string_view &key)
 {
-  try {
-    if (jNodeRoot.isEmpty()) { jNodeRoot = Node::make<Object>(); }
-    return jNodeRoot[key];
-  } catch (Node::Error &) {
-    NRef<Object>(jNodeRoot).add(Object::Entry(key, Node::make<Hole>()));
-    return jNodeRoot[key];
-  }
+  bulkRelease = false;
+  return jNodeRoot.try_emplace(key).first;
 }
 const Node &JSON_Impl::operator[](const std::string_view &key) const { return jNodeRoot[key]; }
 Node &JSON_Impl::operator[](const std::size_t index)
 {
+  bulkRelease = false;
   if (jNodeRoot.isEmpty()) {
     jNodeRoot = Node::make<Array>();
     NRef<Array>(jNodeRoot).resize(index);
@@ -164,6 +216,7 @@ const Node &JSON_Impl::operator[](const std::size_t index) const { return jNodeR
 
 void JSON_Impl::resize(std::size_t index)
 {
+  bulkRelease = false;
   if (jNodeRoot.isEmpty()) { jNodeRoot = Node::make<Array>(); }
   jNodeRoot.resize(index);
 }
@@ -0,0 +1,231 @@
+//
+// Class: Converter
+//
+// Description: Convert characters to/from UTF8 and UTF16. The
+// conversion is done here rather than by the standard library or
+// the operating system so that it is the same on every platform,
+// keeps no shared state (and so may be used from many threads at
+// once) and needs no memory beyond the converted string. Runs of
+// ASCII are converted sixteen bytes (or eight code units) at a
+// time where SSE2 is available.
+//
+// Dependencies: C++20 - Language standard features used.
+//
+
+#include "JSON.hpp"
+#include "JSON_Converter.hpp"
+#include "JSON_Error.hpp"
+#include "JSON_Throw.hpp"
+
+#include <bit>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define JSON_LIB_CONVERTER_SSE2 1
+#include <emmintrin.h>
+#endif
+
+namespace JSON_Lib {
+
+// ========================
+// Unicode surrogate ranges
+// ========================
+
+constexpr char32_t kSurrogatesBegin{ 0xD800 };
+constexpr char32_t kLowSurrogatesStart{ 0xDC00 };
+constexpr char32_t kSurrogatesEnd{ 0xDFFF };
+
+/// <summary>
+/// Return length of the run of ASCII bytes in a UTF-8 string starting at
+/// a given index.
+/// </summary>
+/// <param name="utf8">UTF-8 string.</param>
+/// <param name="next">Index of start of run.</param>
+/// <returns>Number of ASCII bytes.</returns>
+std::size_t asciiRun(const std::string_view &utf8, const std::size_t next) noexcept
+{
+  std::size_t end = next;
+#if JSON_LIB_CONVERTER_SSE2
+  for (; end + 16 <= utf8.size(); end += 16) {
+    const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(utf8.data() + end));
+    if (const int mask = _mm_movemask_epi8(chunk); mask != 0) {
+      return end + static_cast<std::size_t>(std::countr_zero(static_cast<unsigned>(mask))) - next;
+    }
+  }
+#endif
+  while (end < utf8.size() && static_cast<unsigned char>(utf8[end]) < 0x80) { end++; }
+  return end - next;
+}
+/// <summary>
+/// Decode the UTF-8 sequence starting at a given index. Encoded surrogates
+/// are accepted and returned as they are.
+/// </summary>
+/// <param name="utf8">UTF-8 string.</param>
+/// <param name="next">Index of sequence lead byte.</param>
+/// <returns>Code point and sequence length (zero if sequence malformed).</returns>
+std::pair<char32_t, std::size_t> decodeUtf8(const std::string_view &utf8, const std::size_t next) noexcept
+{
+  const auto lead = static_cast<unsigned char>(utf8[next]);
+  std::size_t length{};
+  char32_t codePoint{};
+  char32_t minimum{};
+  if (lead < 0x80) {
+    return { lead, 1 };
+  } else if (lead >= 0xC2 && lead <= 0xDF) {
+    length = 2;
+    codePoint = lead & 0x1F;
+    minimum = 0x80;
+  } else if ((lead & 0xF0) == 0xE0) {
+    length = 3;
+    codePoint = lead & 0x0F;
+    minimum = 0x800;
+  } else if (lead >= 0xF0 && lead <= 0xF4) {
+    length = 4;
+    codePoint = lead & 0x07;
+    minimum = 0x10000;
+  } else {
+    return { 0, 0 };
+  }
+  if (length > utf8.size() - next) { return { 0, 0 }; }
+  for (std::size_t index = 1; index < length; index++) {
+    const auto ch = static_cast<unsigned char>(utf8[next + index]);
+    if ((ch & 0xC0) != 0x80) { return { 0, 0 }; }
+    codePoint = codePoint << 6 | (ch & 0x3F);
+  }
+  if (codePoint < minimum || codePoint > 0x10FFFF) { return { 0, 0 }; }
+  return { codePoint, length };
+}
+/// <summary>
+/// Encode a Unicode code point as UTF-8.
+/// </summary>
+/// <param name="codePoint">Unicode code point.</param>
+/// <param name="bytes">Destination for UTF-8 bytes.</param>
+/// <returns>Number of bytes written.</returns>
+std::size_t encodeUtf8(const char32_t codePoint, char *bytes) noexcept
+{
+  if (codePoint < 0x80) {
+    bytes[0] = static_cast<char>(codePoint);
+    return 1;
+  }
+  if (codePoint < 0x800) {
+    bytes[0] = static_cast<char>(0xC0 | codePoint >> 6);
+    bytes[1] = static_cast<char>(0x80 | (codePoint & 0x3F));
+    return 2;
+  }
+  if (codePoint < 0x10000) {
+    bytes[0] = static_cast<char>(0xE0 | codePoint >> 12);
+    bytes[1] = static_cast<char>(0x80 | (codePoint >> 6 & 0x3F));
+    bytes[2] = static_cast<char>(0x80 | (codePoint & 0x3F));
+    return 3;
+  }
+  bytes[0] = static_cast<char>(0xF0 | codePoint >> 18);
+  bytes[1] = static_cast<char>(0x80 | (codePoint >> 12 & 0x3F));
+  bytes[2] = static_cast<char>(0x80 | (codePoint >> 6 & 0x3F));
+  bytes[3] = static_cast<char>(0x80 | (codePoint & 0x3F));
+  return 4;
+}
+/// <summary>
+/// Transcode UTF-8 to UTF-16. Code points outside the BMP become a
+/// surrogate pair.
+/// </summary>
+/// <param name="utf8">UTF-8 string.</param>
+/// <param name="utf16">Destination for UTF-16 (utf8.size() code units).</param>
+/// <returns>Number of code units written or npos if UTF-8 malformed.</returns>
+std::size_t utf8ToUtf16(const std::string_view &utf8, char16_t *utf16) noexcept
+{
+  std::size_t next = 0;
+  char16_t *output = utf16;
+  while (next < utf8.size()) {
+#if JSON_LIB_CONVERTER_SSE2
+    // Widen sixteen ASCII bytes at a time
+    for (; next + 16 <= utf8.size(); next += 16) {
+      const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(utf8.data() + next));
+      if (_mm_movemask_epi8(chunk) != 0) { break; }
+      _mm_storeu_si128(reinterpret_cast<__m128i *>(output), _mm_unpacklo_epi8(chunk, _mm_setzero_si128()));
+      _mm_storeu_si128(reinterpret_cast<__m128i *>(output + 8), _mm_unpackhi_epi8(chunk, _mm_setzero_si128()));
+      output += 16;
+    }
+#endif
+    while (next < utf8.size() && static_cast<unsigned char>(utf8[next]) < 0x80) {
+      *output++ = static_cast<char16_t>(utf8[next++]);
+    }
+    if (next == utf8.size()) { break; }
+    const auto [codePoint, length] = decodeUtf8(utf8, next);
+    if (length == 0) { return std::string_view::npos; }
+    if (codePoint > 0xFFFF) {
+      *output++ = static_cast<char16_t>(kSurrogatesBegin + ((codePoint - 0x10000) >> 10));
+      *output++ = static_cast<char16_t>(kLowSurrogatesStart + ((codePoint - 0x10000) & 0x3FF));
+    } else {
+      *output++ = static_cast<char16_t>(codePoint);
+    }
+    next += length;
+  }
+  return static_cast<std::size_t>(output - utf16);
+}
+/// <summary>
+/// Transcode UTF-16 to UTF-8. Surrogate pairs are combined into a single
+/// code point.
+/// </summary>
+/// <param name="utf16">UTF-16 string.</param>
+/// <param name="utf8">Destination for UTF-8 (3 * utf16.size() bytes).</param>
+/// <returns>Number of bytes written or npos if there is an unpaired surrogate.</returns>
+std::size_t utf16ToUtf8(const std::u16string_view &utf16, char *utf8) noexcept
+{
+  std::size_t next = 0;
+  char *output = utf8;
+  while (next < utf16.size()) {
+#if JSON_LIB_CONVERTER_SSE2
+    // Narrow eight ASCII code units at a time
+    for (; next + 8 <= utf16.size(); next += 8) {
+      const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(utf16.data() + next));
+      const __m128i high = _mm_and_si128(chunk, _mm_set1_epi16(static_cast<short>(0xFF80)));
+      if (_mm_movemask_epi8(_mm_cmpeq_epi16(high, _mm_setzero_si128())) != 0xFFFF) { break; }
+      _mm_storel_epi64(reinterpret_cast<__m128i *>(output), _mm_packus_epi16(chunk, chunk));
+      output += 8;
+    }
+#endif
+    while (next < utf16.size() && utf16[next] < 0x80) { *output++ = static_cast<char>(utf16[next++]); }
+    if (next == utf16.size()) { break; }
+    char32_t codePoint = utf16[next++];
+    if (codePoint >= kSurrogatesBegin && codePoint <= kSurrogatesEnd) {
+      if (codePoint >= kLowSurrogatesStart || next == utf16.size() || utf16[next] < kLowSurrogatesStart
+          || utf16[next] > kSurrogatesEnd) {
+        return std::string_view::npos;
+      }
+      codePoint = 0x10000 + ((codePoint - kSurrogatesBegin) << 10) + (utf16[next++] - kLowSurrogatesStart);
+    }
+    output += encodeUtf8(codePoint, output);
+  }
+  return static_cast<std::size_t>(output - utf8);
+}
+
+/// <summary>
+/// Convert utf8 <-> utf16 strings.
+/// </summary>
+std::u16string toUtf16(const std::string_view &utf8)
+{
+  if (utf8.find('\0') != std::string_view::npos) { JSON_THROW(Error("Tried to convert a null character.")); }
+  bool malformed = false;
+  std::u16string utf16;
+  utf16.resize_and_overwrite(utf8.size(), [&](char16_t *buffer, std::size_t) {
+    const auto length = utf8ToUtf16(utf8, buffer);
+    malformed = length == std::string_view::npos;
+    return malformed ? 0 : length;
+  });
+  if (malformed) { JSON_THROW(Error("Invalid UTF-8 character sequence.")); }
+  return utf16;
+}
+std::string toUtf8(const std::u16string_view &utf16)
+{
+  if (utf16.find(u'\0') != std::u16string_view::npos) { JSON_THROW(Error("Tried to convert a null character.")); }
+  bool malformed = false;
+  std::string utf8;
+  utf8.resize_and_overwrite(utf16.size() * 3, [&](char *buffer, std::size_t) {
+    const auto length = utf16ToUtf8(utf16, buffer);
+    malformed = length == std::string_view::npos;
+    return malformed ? 0 : length;
+  });
+  if (malformed) { JSON_THROW(Error("Invalid UTF-16 character sequence.")); }
+  return utf8;
+}
+
+}// namespace JSON_Lib
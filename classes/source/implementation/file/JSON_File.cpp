@@ -14,8 +14,9 @@
 #include "JSON_Throw.hpp"
 
 #if !JSON_LIB_NO_STDIO
+#include <algorithm>
+#include <array>
 #include <fstream>
-#include <sstream>
 #endif
 
 namespace JSON_Lib {
@@ -52,40 +53,137 @@ void writeJSONString(std::ofstream &jsonFile, const std::u16string_view &jsonStr
   }
 }
 
+// Bytes appended per read when the size of a file stream cannot be found
+constexpr std::size_t kReadBlockSize{ 64 * 1024 };
 /// <summary>
-/// Read JSON string from a file stream.
+/// Read the rest of a file stream into a string. Where the stream can seek
+/// its remaining length is read in one go; pipes, FIFOs and /proc files
+/// report no usable length (tellg() fails or gives zero), so whatever is
+/// left is then read a block at a time until end of file.
 /// </summary>
 /// <param name="jsonFile">JSON file stream</param>
 /// <returns>JSON string.</returns>
-std::string readJSONString(const std::ifstream &jsonFile)
+std::string readJSONString(std::ifstream &jsonFile)
 {
-  std::ostringstream jsonFileBuffer;
-  jsonFileBuffer << jsonFile.rdbuf();
-  return jsonFileBuffer.str();
+  std::string jsonString;
+  if (const auto start = jsonFile.tellg(); start != std::streampos(-1) && jsonFile.seekg(0, std::ios_base::end)) {
+    const auto end = jsonFile.tellg();
+    jsonFile.seekg(start);
+    if (end != std::streampos(-1) && end > start) {
+      jsonString.resize(static_cast<std::size_t>(end - start));
+      jsonFile.read(jsonString.data(), static_cast<std::streamsize>(jsonString.size()));
+      jsonString.resize(static_cast<std::size_t>(jsonFile.gcount()));
+    }
+  }
+  jsonFile.clear();
+  std::array<char, kReadBlockSize> block;
+  while (jsonFile.read(block.data(), static_cast<std::streamsize>(block.size())) || jsonFile.gcount() > 0) {
+    jsonString.append(block.data(), static_cast<std::size_t>(jsonFile.gcount()));
+  }
+  return jsonString;
+}
+/// <summary>
+/// Return the format indicated by any byte order mark at the start of a
+/// file's contents. Bytes missing from a short file are taken as 0xFF.
+/// </summary>
+/// <param name="bytes">Start of the file contents.</param>
+/// <returns>JSON file format.</returns>
+JSON::Format byteOrderMarkFormat(const std::string_view &bytes)
+{
+  uint32_t byteOrderMark = 0;
+  for (std::size_t index = 0; index < 4; index++) {
+    byteOrderMark = byteOrderMark << 8 | (index < bytes.size() ? static_cast<unsigned char>(bytes[index]) : 0xFF);
+  }
+  if (byteOrderMark == 0x0000FEFF) { return JSON::Format::utf32BE; }
+  if (byteOrderMark == 0xFFFE0000) { return JSON::Format::utf32LE; }
+  if ((byteOrderMark & 0xFFFFFF00) == 0xEFBBBF00) { return JSON::Format::utf8BOM; }
+  if ((byteOrderMark & 0xFFFF0000) == 0xFEFF0000) { return JSON::Format::utf16BE; }
+  if ((byteOrderMark & 0xFFFF0000) == 0xFFFE0000) { return JSON::Format::utf16LE; }
+  return JSON::Format::utf8;
 }
-std::u16string readJSONString(std::ifstream &jsonFile, const JSON::Format format)
+// Code units assembled per call to utf16ToUtf8() when transcoding a UTF-16 file
+constexpr std::size_t kTranscodeBlockUnits{ 4096 };
+/// <summary>
+/// Return the code unit at a given index of a UTF-16 or UTF-32 byte string.
+/// </summary>
+/// <param name="bytes">File contents.</param>
+/// <param name="index">Code unit index.</param>
+/// <param name="unitSize">Code unit size in bytes (2 or 4).</param>
+/// <param name="bigEndian">== true then most significant byte first.</param>
+/// <returns>Code unit.</returns>
+char32_t codeUnit(const std::string_view &bytes, const std::size_t index, const std::size_t unitSize, const bool bigEndian)
+{
+  char32_t unit{};
+  for (std::size_t offset = 0; offset < unitSize; offset++) {
+    unit = unit << 8
+           | static_cast<unsigned char>(bytes[index * unitSize + (bigEndian ? offset : unitSize - 1 - offset)]);
+  }
+  return unit;
+}
+/// <summary>
+/// Transcode UTF-16 file contents (after the byte order mark) to UTF-8.
+/// Code units are assembled a block at a time and each block transcoded
+/// with one call; a high surrogate ending a block is carried over to pair
+/// with the start of the next. A trailing odd byte is ignored.
+/// </summary>
+/// <param name="bytes">File contents.</param>
+/// <param name="bigEndian">== true then UTF-16BE.</param>
+/// <returns>JSON string.</returns>
+std::string transcodeUtf16(const std::string_view &bytes, const bool bigEndian)
 {
-  std::u16string utf16String;
-  // Move past byte order mark
-  jsonFile.seekg(2);
-  if (format == JSON::Format::utf16BE)
-    while (true) {
-      char16_t ch16 = static_cast<char>(jsonFile.get()) << 8;
-      ch16 |= static_cast<char>(jsonFile.get());
-      if (jsonFile.eof()) break;
-      utf16String.push_back(ch16);
+  const std::size_t units = bytes.size() / 2;
+  std::array<char16_t, kTranscodeBlockUnits> block{};
+  std::size_t carried = 0;
+  bool nullFound = false;
+  bool malformed = false;
+  std::string utf8;
+  utf8.resize_and_overwrite(units * 3, [&](char *buffer, std::size_t) {
+    std::size_t length = 0;
+    for (std::size_t unit = 0; unit < units && !nullFound && !malformed;) {
+      std::size_t count = carried;
+      for (; count < block.size() && unit < units; count++, unit++) {
+        block[count] = static_cast<char16_t>(codeUnit(bytes, unit, 2, bigEndian));
+        nullFound |= block[count] == 0;
+      }
+      const char16_t lastUnit = block[count - 1];
+      carried = unit < units && lastUnit >= 0xD800 && lastUnit <= 0xDBFF ? 1 : 0;
+      const auto written = utf16ToUtf8(std::u16string_view(block.data(), count - carried), buffer + length);
+      malformed = written == std::string_view::npos;
+      if (!malformed) { length += written; }
+      block[0] = lastUnit;
     }
-  else if (format == JSON::Format::utf16LE) {
-    while (true) {
-      char16_t ch16 = static_cast<char>(jsonFile.get());
-      ch16 |= static_cast<char>(jsonFile.get()) << 8;
-      if (jsonFile.eof()) break;
-      utf16String.push_back(ch16);
+    return nullFound || malformed ? 0 : length;
+  });
+  if (nullFound) { JSON_THROW(Error("Tried to convert a null character.")); }
+  if (malformed) { JSON_THROW(Error("Invalid UTF-16 character sequence.")); }
+  return utf8;
+}
+/// <summary>
+/// Transcode UTF-32 file contents (after the byte order mark) to UTF-8.
+/// Any trailing partial code unit is ignored.
+/// </summary>
+/// <param name="bytes">File contents.</param>
+/// <param name="bigEndian">== true then UTF-32BE.</param>
+/// <returns>JSON string.</returns>
+std::string transcodeUtf32(const std::string_view &bytes, const bool bigEndian)
+{
+  const std::size_t units = bytes.size() / 4;
+  bool nullFound = false;
+  bool malformed = false;
+  std::string utf8;
+  utf8.resize_and_overwrite(units * kMaxUtf8Bytes, [&](char *buffer, std::size_t) {
+    std::size_t length = 0;
+    for (std::size_t unit = 0; unit < units && !nullFound && !malformed; unit++) {
+      const char32_t codePoint = codeUnit(bytes, unit, 4, bigEndian);
+      nullFound = codePoint == 0;
+      malformed = codePoint > 0x10FFFF || (codePoint >= 0xD800 && codePoint <= 0xDFFF);
+      length += encodeUtf8(codePoint, buffer + length);
     }
-  } else {
-    JSON_THROW(Error("Unsupported JSON file format (Byte Order Mark) specified in call to readJSONString()."));
-  }
-  return utf16String;
+    return nullFound || malformed ? 0 : length;
+  });
+  if (nullFound) { JSON_THROW(Error("Tried to convert a null character.")); }
+  if (malformed) { JSON_THROW(Error("Invalid UTF-32 character sequence.")); }
+  return utf8;
 }
 
 /// <summary>
@@ -97,17 +195,9 @@ std::u16string readJSONString(std::ifstream &jsonFile, const JSON::Format format
 JSON::Format JSON_Impl::getFileFormat(const std::string_view &fileName)
 {
   std::ifstream jsonFile{ fileName.data(), std::ios_base::binary };
-  uint32_t byteOrderMark = static_cast<unsigned char>(jsonFile.get()) << 24;
-  byteOrderMark |= static_cast<unsigned char>(jsonFile.get()) << 16;
-  byteOrderMark |= static_cast<unsigned char>(jsonFile.get()) << 8;
-  byteOrderMark |= static_cast<unsigned char>(jsonFile.get());
-  if (byteOrderMark == 0x0000FEFF) { return JSON::Format::utf32BE; }
-  if (byteOrderMark == 0xFFFE0000) { return JSON::Format::utf32LE; }
-  if ((byteOrderMark & 0xFFFFFF00) == 0xEFBBBF00) { return JSON::Format::utf8BOM; }
-  if ((byteOrderMark & 0xFFFF0000) == 0xFEFF0000) { return JSON::Format::utf16BE; }
-  if ((byteOrderMark & 0xFFFF0000) == 0xFFFE0000) { return JSON::Format::utf16LE; }
-  jsonFile.close();
-  return JSON::Format::utf8;
+  std::array<char, 4> bytes{};
+  jsonFile.read(bytes.data(), bytes.size());
+  return byteOrderMarkFormat(std::string_view(bytes.data(), static_cast<std::size_t>(jsonFile.gcount())));
 }
 
 /// <summary>
@@ -120,32 +210,37 @@ JSON::Format JSON_Impl::getFileFormat(const std::string_view &fileName)
 std::string JSON_Impl::fromFile(const std::string_view &fileName)
 {
   constexpr auto kCRLF = "\x0D\x0A";
-  // Get file format
-  const JSON::Format format = getFileFormat(fileName);
-  // Read in JSON
+  // Read in JSON with one open so that pipes and FIFOs can be read, then check its byte order mark
   std::ifstream jsonFile{ fileName.data(), std::ios_base::binary };
-  std::string translated;
-  switch (format) {
+  std::string translated{ readJSONString(jsonFile) };
+  jsonFile.close();
+  switch (const JSON::Format format = byteOrderMarkFormat(translated)) {
   case JSON::Format::utf8BOM:
-    jsonFile.seekg(3);// Move past byte order mark
-    JSON_LIB_FALLTHROUGH;
+    translated.erase(0, 3);// Move past byte order mark
+    break;
   case JSON::Format::utf8:
-    translated = readJSONString(jsonFile);
     break;
   case JSON::Format::utf16BE:
   case JSON::Format::utf16LE:
-    translated = toUtf8(readJSONString(jsonFile, format));
+    translated = transcodeUtf16(std::string_view(translated).substr(2), format == JSON::Format::utf16BE);
+    break;
+  case JSON::Format::utf32BE:
+  case JSON::Format::utf32LE:
+    translated = transcodeUtf32(std::string_view(translated).substr(4), format == JSON::Format::utf32BE);
     break;
   default:
     JSON_THROW(Error("Unsupported JSON file format (Byte Order Mark) encountered."));
   }
-  jsonFile.close();
-  // Translate CRLF -> LF
-  size_t pos = translated.find(kCRLF);
-  while (pos != std::string::npos) {
-    constexpr auto kLF = "\x0A";
-    translated.replace(pos, 2, kLF);
-    pos = translated.find(kCRLF, pos + 1);
+  // Translate CRLF -> LF, moving the text between each CR down in one pass
+  if (std::size_t out = translated.find(kCRLF); out != std::string::npos) {
+    std::size_t in = out + 1;
+    for (auto cr = translated.find(kCRLF, in); cr != std::string::npos; cr = translated.find(kCRLF, in)) {
+      std::copy(translated.begin() + in, translated.begin() + cr, translated.begin() + out);
+      out += cr - in;
+      in = cr + 1;
+    }
+    std::copy(translated.begin() + in, translated.end(), translated.begin() + out);
+    translated.resize(out + translated.size() - in);
   }
   return translated;
 }
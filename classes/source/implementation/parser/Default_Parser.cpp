@@ -10,66 +10,41 @@
 #include "JSON_Node_Core.hpp"
 #include "Default_Parser.hpp"
 #include "JSON_Char_Constants.hpp"
+#include "JSON_Escapes.hpp"
+#include "JSON_Lexer.hpp"
+#include "JSON_SpanCursor.hpp"
 #include "JSON_Throw.hpp"
+#include <algorithm>
 #include <array>
 #include <string_view>
+#include <type_traits>
 
 namespace JSON_Lib {
 
 /// <summary>
-/// Check whether character is a valid-escaped character or is just
-/// normally escaped ASCII character. Only a few characters are valid
-/// escaped characters such as '\t' or '\"' but normal ASCII characters
-/// may still be can still have a '\' prefix and be escaped though not
-/// proper escaped sense.
+/// Extract a string from contiguous JSON as a view of the source bytes rather
+/// than a copy. Only strings without escapes are borrowed; one containing them
+/// (and any error) goes through extractString(), so escapes are decoded and
+/// checked during the parse and a borrowed string is never modified by a read.
 /// </summary>
-/// <param name="escape">Escaped character.</param>
-/// <returns>True then character is a valid escape character.</returns>
-bool validEscape(const char escape)
-{
-  return escape == JSON_Lib::kEscape || escape == 't' || escape == JSON_Lib::kStringQuote || escape == 'b'
-         || escape == 'f' || escape == 'n' || escape == 'r' || escape == 'u';
-}
-/// <summary>
-/// Extract a string from a JSON encoded source stream.
-/// </summary>
-/// <param name="source">Source of JSON.</param>
+/// <param name="source">Cursor over contiguous JSON.</param>
 /// <param name="translator">String translator.</param>
+/// <param name="error">Parse error.</param>
 /// <returns>Extracted string</returns>
-String extractString(ISource &source, const ITranslator &translator)
+String borrowString(SpanCursor &source, const ITranslator &translator, ParseError &error)
 {
-  uint64_t stringLength = 0;
-  bool translateEscapes = false;
-  if (source.current() != '"') { JSON_THROW(SyntaxError(source.getPosition(), "Missing opening '\"' on string.")); }
-  source.next();
-  String extracted;
-  extracted.reserve(64);
-  while (source.more() && source.current() != JSON_Lib::kStringQuote) {
-    if (source.current() == '\\') {
-      extracted.append('\\');
-      source.next();
-      if (!validEscape(source.current())) { extracted.pop_back(); }
-      translateEscapes = true;
+  if (source.current() == JSON_Lib::kStringQuote) {
+    const auto remaining = source.remaining();
+    const auto end = remaining.find_first_of(R"("\)", 1);
+    if (end != std::string_view::npos && remaining[end] == JSON_Lib::kStringQuote) {
+      String borrowed{ String::borrow(remaining.substr(1, end - 1)) };
+      if (end - 1 <= borrowed.getMaxStringLength()) {
+        source.advance(end + 1);
+        return borrowed;
+      }
     }
-    extracted.append(source.current());
-    stringLength++;
-    if (stringLength > extracted.getMaxStringLength()) { JSON_THROW(SyntaxError("String size exceeds maximum allowed size.")); }
-    source.next();
   }
-  if (source.current() != '"') { JSON_THROW(SyntaxError(source.getPosition(), "Missing closing '\"' on string.")); }
-  if (translateEscapes) { extracted = String{translator.from(extracted.value())}; }
-  source.next();
-  return extracted;
-}
-/// <summary>
-/// Has the end of a number been reached in source stream?
-/// </summary>
-/// <param name="source">Source of JSON.</param>
-/// <returns>True on end of number</returns>
-bool endOfNumber(const ISource &source)
-{
-  return source.isWS() || source.current() == JSON_Lib::kComma || source.current() == JSON_Lib::kArrayEnd
-         || source.current() == JSON_Lib::kObjectEnd;
+  return extractString(source, translator, error);
 }
 /// <summary>
 /// Parse an Object key/value pair from a JSON encoded source stream.
@@ -78,14 +53,16 @@ bool endOfNumber(const ISource &source)
 /// <param name="translator">String translator.</param>
 /// <param name="parserDepth">Current parser depth.</param>
 /// <returns>Object key/value pair.</returns>
-Object::Entry
-  Default_Parser::parseObjectEntry(ISource &source, const unsigned long parserDepth, const unsigned long maxDepth)
+template<typename Source> Object::Entry
+  Default_Parser::parseObjectEntry(Source &source, const unsigned long parserDepth, const unsigned long maxDepth)
 {
   source.ignoreWS();
-  std::string key{ extractString(source, jsonTranslator).value() };
+  String key{ extractKey(source) };
+  if (m_error) { return { std::move(key), Node{} }; }
   source.ignoreWS();
   if (source.current() != JSON_Lib::kColon) {
-    JSON_THROW(SyntaxError(source.getPosition(), "Missing ':' in key value pair."));
+    m_error.set(ParseError::Kind::syntax, "Missing ':' in key value pair.", source.getPosition());
+    return { std::move(key), Node{} };
   }
   source.next();
   return { std::move(key), parseNodes(source, parserDepth + 1, maxDepth) };
@@ -97,9 +74,24 @@ Object::Entry
 /// <param name="translator">String translator.</param>
 /// <param name="parserDepth">Current parser depth.</param>
 /// <returns>String Node.</returns>
-Node Default_Parser::parseString(ISource &source, unsigned long)
+template<typename Source> Node Default_Parser::parseString(Source &source, unsigned long)
 {
-  return Node::make<String>(extractString(source, jsonTranslator));
+  if constexpr (std::is_same_v<Source, SpanCursor>) {
+    if (m_borrowStrings) { return Node::make<String>(borrowString(source, jsonTranslator, m_error)); }
+  }
+  return Node::make<String>(extractString(source, jsonTranslator, m_error));
+}
+/// <summary>
+/// Extract an object key (borrowed, as strings are, when it has no escapes).
+/// </summary>
+/// <param name="source">Source of JSON.</param>
+/// <returns>Key string.</returns>
+template<typename Source> String Default_Parser::extractKey(Source &source)
+{
+  if constexpr (std::is_same_v<Source, SpanCursor>) {
+    if (m_borrowStrings) { return borrowString(source, jsonTranslator, m_error); }
+  }
+  return extractString(source, jsonTranslator, m_error);
 }
 /// <summary>
 /// Parse a number from a JSON source stream.
@@ -108,22 +100,9 @@ Node Default_Parser::parseString(ISource &source, unsigned long)
 /// <param name="translator">String translator.</param>
 /// <param name="parserDepth">Current parser depth.</param>
 /// <returns>Number Node.</returns>
-Node Default_Parser::parseNumber(ISource &source, unsigned long)
+template<typename Source> Node Default_Parser::parseNumber(Source &source, unsigned long)
 {
-  static constexpr std::size_t kMaxNumberLength = 64;
-  std::array<char, kMaxNumberLength> numberText{};
-  std::size_t numberLength = 0;
-  while (source.more() && !endOfNumber(source)) {
-    if (numberLength >= numberText.size()) { JSON_THROW(SyntaxError("Number size exceeds maximum allowed length.")); }
-    numberText[numberLength++] = source.current();
-    source.next();
-  }
-  const std::string_view numberView(numberText.data(), numberLength);
-  Number number{ numberView };
-  if (number.isValid()) {
-    return Node::make<Number>(number);
-  }
-  JSON_THROW(SyntaxError(source.getPosition(), "Invalid numeric value."));
+  return Node::make<Number>(extractNumber(source, m_error));
 }
 /// <summary>
 /// Parse a boolean from a JSON source stream.
@@ -132,13 +111,14 @@ Node Default_Parser::parseNumber(ISource &source, unsigned long)
 /// <param name="translator">String translator.</param>
 /// <param name="parserDepth">Current parser depth.</param>
 /// <returns>Boolean Node.</returns>
-Node Default_Parser::parseBoolean(ISource &source, unsigned long)
+template<typename Source> Node Default_Parser::parseBoolean(Source &source, unsigned long)
 {
   static constexpr std::string_view kTrueToken{"true"};
   static constexpr std::string_view kFalseToken{"false"};
   if (source.match(kTrueToken)) { return Node::make<Boolean>(true); }
   if (source.match(kFalseToken)) { return Node::make<Boolean>(false); }
-  JSON_THROW(SyntaxError(source.getPosition(), "Invalid boolean value."));
+  m_error.set(ParseError::Kind::syntax, "Invalid boolean value.", source.getPosition());
+  return {};
 }
 /// <summary>
 /// Parse a null from a JSON source stream.
@@ -147,10 +127,13 @@ Node Default_Parser::parseBoolean(ISource &source, unsigned long)
 /// <param name="translator">String translator.</param>
 /// <param name="parserDepth">Current parser depth.</param>
 /// <returns>Null Node.</returns>
-Node Default_Parser::parseNull(ISource &source, unsigned long)
+template<typename Source> Node Default_Parser::parseNull(Source &source, unsigned long)
 {
   static constexpr std::string_view kNullToken{"null"};
-  if (!source.match(kNullToken)) { JSON_THROW(SyntaxError(source.getPosition(), "Invalid null value.")); }
+  if (!source.match(kNullToken)) {
+    m_error.set(ParseError::Kind::syntax, "Invalid null value.", source.getPosition());
+    return {};
+  }
   return Node::make<Null>();
 }
 /// <summary>
@@ -162,44 +145,56 @@ Node Default_Parser::parseNull(ISource &source, unsigned long)
 /// <returns>Object Node (key/value pairs).</returns>
 /// Parse a collection (object or array) from a JSON source stream.
 /// Handles the open / first-element / comma-loop / check-close / advance pattern
-/// common to both containers.
-template<typename NodeType, typename ParseFn>
-static Node parseCollection(ISource &source,
+/// common to both containers, stopping at the first error recorded (the part
+/// of the collection read so far is returned, for the caller to discard).
+template<typename NodeType, typename Source, typename AddFn>
+static Node parseCollection(Source &source,
   const unsigned long parserDepth,
   const char closeChar,
   const char *missingCloseMsg,
-  ParseFn parseElement)
+  ParseError &error,
+  AddFn addElement)
 {
   Node jNode = Node::make<NodeType>();
+  auto &collection = NRef<NodeType>(jNode);
   source.next();
   source.ignoreWS();
   if (source.current() != closeChar) {
-    NRef<NodeType>(jNode).add(parseElement(source, parserDepth));
-    while (source.current() == ',') {
+    addElement(source, parserDepth, collection);
+    while (!error && source.current() == ',') {
       source.next();
-      NRef<NodeType>(jNode).add(parseElement(source, parserDepth));
+      addElement(source, parserDepth, collection);
     }
+    if (error) { return jNode; }
+  }
+  if (source.current() != closeChar) {
+    error.set(ParseError::Kind::syntax, missingCloseMsg, source.getPosition());
+    return jNode;
   }
-  if (source.current() != closeChar) { JSON_THROW(SyntaxError(source.getPosition(), missingCloseMsg)); }
   source.next();
   return jNode;
 }
-Node Default_Parser::parseObject(ISource &source, const unsigned long parserDepth, const unsigned long maxDepth)
+template<typename Source>
+Node Default_Parser::parseObject(Source &source, const unsigned long parserDepth, const unsigned long maxDepth)
 {
   return parseCollection<Object>(
     source, parserDepth,
-    JSON_Lib::kObjectEnd, "Missing closing '}' in object definition.",
-    [this, maxDepth](ISource &src, unsigned long depth) {
-      return parseObjectEntry(src, depth, maxDepth);
+    JSON_Lib::kObjectEnd, "Missing closing '}' in object definition.", m_error,
+    [this, maxDepth](Source &src, unsigned long depth, Object &object) {
+      // An entry cut short by an error may still be added; the object is discarded anyway
+      if (!object.tryAdd(parseObjectEntry(src, depth, maxDepth)) && !m_error) {
+        m_error.set(ParseError::Kind::node, "Duplicate key used to add object entry.");
+      }
     });
 }
-Node Default_Parser::parseArray(ISource &source, const unsigned long parserDepth, const unsigned long maxDepth)
+template<typename Source>
+Node Default_Parser::parseArray(Source &source, const unsigned long parserDepth, const unsigned long maxDepth)
 {
   return parseCollection<Array>(
     source, parserDepth,
-    JSON_Lib::kArrayEnd, "Missing closing ']' in array definition.",
-    [this, maxDepth](ISource &src, unsigned long depth) {
-      return parseNodes(src, depth + 1, maxDepth);
+    JSON_Lib::kArrayEnd, "Missing closing ']' in array definition.", m_error,
+    [this, maxDepth](Source &src, unsigned long depth, Array &array) {
+      array.add(parseNodes(src, depth + 1, maxDepth));
     });
 }
 /// <summary>
@@ -211,12 +206,16 @@ Node Default_Parser::parseArray(ISource &source, const unsigned long parserDepth
 /// <param name="translator">String translator.</param>
 /// <param name="parserDepth">Current parser depth.</param>
 /// <returns>Pointer to Node.</returns>
-Node Default_Parser::parseNodes(ISource &source, const unsigned long parserDepth, const unsigned long maxDepth)
+template<typename Source>
+Node Default_Parser::parseNodes(Source &source, const unsigned long parserDepth, const unsigned long maxDepth)
 {
-  if (parserDepth >= maxDepth) { JSON_THROW(SyntaxError("Maximum parser depth exceeded.")); }
+  Node jNode;
+  if (parserDepth >= maxDepth) {
+    m_error.set(ParseError::Kind::syntax, "Maximum parser depth exceeded.");
+    return jNode;
+  }
   source.ignoreWS();
   const char nextChar = source.current();
-  Node jNode;
   switch (nextChar) {
     case JSON_Lib::kObjectBegin:
       jNode = parseObject(source, parserDepth, maxDepth);
@@ -249,11 +248,152 @@ Node Default_Parser::parseNodes(ISource &source, const unsigned long parserDepth
     case 'n':
       jNode = parseNull(source, parserDepth);
       break;
+    default:
+      m_error.set(ParseError::Kind::syntax, "Missing String, Number, Boolean, Array, Object or Null.", source.getPosition());
+      return jNode;
+  }
+  if (!m_error) { source.ignoreWS(); }
+  return jNode;
+}
+/// <summary>
+/// Raise the events for a collection (object or array) from a JSON source stream;
+/// the same open / first-element / comma-loop / check-close pattern as parseCollection().
+/// </summary>
+template<typename Source, typename EmitFn>
+static void emitCollection(Source &source, const char closeChar, const char *missingCloseMsg, EmitFn emitElement)
+{
+  source.next();
+  source.ignoreWS();
+  if (source.current() != closeChar) {
+    emitElement();
+    while (source.current() == ',') {
+      source.next();
+      emitElement();
+    }
+  }
+  if (source.current() != closeChar) { JSON_THROW(SyntaxError(source.getPosition(), missingCloseMsg)); }
+  source.next();
+}
+template<typename Source>
+void Default_Parser::emitObject(Source &source, IEvents &events, const unsigned long parserDepth, const unsigned long maxDepth)
+{
+  events.onObjectStart();
+  emitCollection(source, JSON_Lib::kObjectEnd, "Missing closing '}' in object definition.", [&] {
+    source.ignoreWS();
+    events.onKey(extractText(source, jsonTranslator, m_eventText, m_maxEventText));
+    source.ignoreWS();
+    if (source.current() != JSON_Lib::kColon) {
+      JSON_THROW(SyntaxError(source.getPosition(), "Missing ':' in key value pair."));
+    }
+    source.next();
+    emitNodes(source, events, parserDepth + 1, maxDepth);
+  });
+  events.onObjectEnd();
+}
+template<typename Source>
+void Default_Parser::emitArray(Source &source, IEvents &events, const unsigned long parserDepth, const unsigned long maxDepth)
+{
+  events.onArrayStart();
+  emitCollection(source, JSON_Lib::kArrayEnd, "Missing closing ']' in array definition.", [&] {
+    emitNodes(source, events, parserDepth + 1, maxDepth);
+  });
+  events.onArrayEnd();
+}
+/// <summary>
+/// Recursively parse JSON source stream raising an event for each value; the
+/// grammar, depth limit and error reports are those of parseNodes() except that
+/// a repeated key is passed on rather than rejected.
+/// </summary>
+/// <param name="source">Source of JSON.</param>
+/// <param name="events">Callbacks to raise.</param>
+/// <param name="parserDepth">Current parser depth.</param>
+/// <param name="maxDepth">Maximum parser depth.</param>
+template<typename Source>
+void Default_Parser::emitNodes(Source &source, IEvents &events, const unsigned long parserDepth, const unsigned long maxDepth)
+{
+  static constexpr std::string_view kTrueToken{ "true" };
+  static constexpr std::string_view kFalseToken{ "false" };
+  static constexpr std::string_view kNullToken{ "null" };
+  if (parserDepth >= maxDepth) { JSON_THROW(SyntaxError("Maximum parser depth exceeded.")); }
+  source.ignoreWS();
+  switch (source.current()) {
+    case JSON_Lib::kObjectBegin:
+      emitObject(source, events, parserDepth, maxDepth);
+      break;
+    case JSON_Lib::kArrayBegin:
+      emitArray(source, events, parserDepth, maxDepth);
+      break;
+    case JSON_Lib::kStringQuote:
+    case JSON_Lib::kStringSingleQuote:
+      events.onString(extractText(source, jsonTranslator, m_eventText, m_maxEventText));
+      break;
+    case JSON_Lib::kPlus:
+    case JSON_Lib::kMinus:
+    case JSON_Lib::kZero:
+    case JSON_Lib::kOne:
+    case JSON_Lib::kTwo:
+    case JSON_Lib::kThree:
+    case JSON_Lib::kFour:
+    case JSON_Lib::kFive:
+    case JSON_Lib::kSix:
+    case JSON_Lib::kSeven:
+    case JSON_Lib::kEight:
+    case JSON_Lib::kNine:
+      events.onNumber(extractNumber(source));
+      break;
+    case 't':
+    case 'f':
+      if (source.match(kTrueToken)) {
+        events.onBoolean(true);
+      } else if (source.match(kFalseToken)) {
+        events.onBoolean(false);
+      } else {
+        JSON_THROW(SyntaxError(source.getPosition(), "Invalid boolean value."));
+      }
+      break;
+    case 'n':
+      if (!source.match(kNullToken)) { JSON_THROW(SyntaxError(source.getPosition(), "Invalid null value.")); }
+      events.onNull();
+      break;
     default:
       JSON_THROW(SyntaxError(source.getPosition(), "Missing String, Number, Boolean, Array, Object or Null."));
   }
   source.ignoreWS();
-  return jNode;
+}
+/// <summary>
+/// Parse JSON held in contiguous memory. The grammar runs over a SpanCursor on the
+/// raw bytes and the source is then advanced past what was consumed in one step. On
+/// an error the source is left where character-by-character parsing would have
+/// stopped so that the reported line/column are the same.
+/// </summary>
+/// <param name="source">Source of JSON.</param>
+/// <param name="span">Unread bytes of the source.</param>
+/// <returns>Pointer to Node.</returns>
+Node Default_Parser::parseContiguous(ISource &source, const std::string_view &span)
+{
+  SpanCursor cursor{ span, source.getPosition() };
+  try {
+    Node jNode = parseNodes(cursor, 1, m_maxParserDepth);
+    source.advance(m_error ? cursor.errorOffset() : cursor.consumed());
+    return jNode;
+  } catch (...) {
+    source.advance(cursor.errorOffset());
+    throw;
+  }
+}
+/// <summary>
+/// Parse JSON source stream producing a Node structure representation of it.
+/// Errors in the JSON are recorded in m_error (the Node returned is then
+/// empty) rather than thrown; only the source, translator and allocator can
+/// still throw from here.
+/// </summary>
+/// <param name="source">Source of JSON.</param>
+/// <returns>Node tree.</returns>
+Node Default_Parser::parseTree(ISource &source)
+{
+  m_error.clear();
+  if (const auto span = source.contiguous(); !span.empty()) { return parseContiguous(source, span); }
+  return parseNodes(source, 1, m_maxParserDepth);
 }
 /// <summary>
 /// Parse JSON source stream producing a Node structure representation  of it. Note: If no obvious match
@@ -261,26 +401,57 @@ Node Default_Parser::parseNodes(ISource &source, const unsigned long parserDepth
 /// </summary>
 /// <param name="source">Source of JSON.</param>
 /// <returns>Pointer to Node.</returns>
-Node Default_Parser::parse(ISource &source) { return parseNodes(source, 1, m_maxParserDepth); }
+Node Default_Parser::parse(ISource &source)
+{
+  Node jNode = parseTree(source);
+  if (m_error) { m_error.raise(); }
+  return jNode;
+}
+/// <summary>
+/// Parse JSON source stream raising an event for each value read rather than
+/// building a Node tree, so memory use is bounded by nesting depth. Contiguous
+/// sources are read through a SpanCursor as for parse().
+/// </summary>
+/// <param name="source">Source of JSON.</param>
+/// <param name="events">Callbacks to raise.</param>
+void Default_Parser::parseEvents(ISource &source, IEvents &events)
+{
+  m_maxEventText = String{}.getMaxStringLength();
+  if (const auto span = source.contiguous(); !span.empty()) {
+    SpanCursor cursor{ span, source.getPosition() };
+    try {
+      emitNodes(cursor, events, 1, m_maxParserDepth);
+      source.advance(cursor.consumed());
+    } catch (...) {
+      source.advance(cursor.errorOffset());
+      throw;
+    }
+    return;
+  }
+  emitNodes(source, events, 1, m_maxParserDepth);
+}
 Result<Node> Default_Parser::parseResult(ISource &source)
 {
 #if JSON_LIB_NO_EXCEPTIONS
   // Under NO_EXCEPTIONS, sources that fail construction (e.g. FixedBufferSource{nullptr,0})
   // set an invalid state rather than throwing. Detect this before parseNodes can abort.
   if (!source.more()) {
-    return {Status::InvalidInput, nullptr, "Empty or invalid source buffer.", source.getPosition()};
+    return {Status::InvalidInput, std::nullopt, "Empty or invalid source buffer.", source.getPosition()};
   }
 #endif
   try {
-    return {Status::Ok, std::make_unique<Node>(parseNodes(source, 1, m_maxParserDepth)), {}, {0, 0}};
+    // Errors in the JSON come back through m_error; nothing is thrown for them
+    Node jNode = parseTree(source);
+    if (!m_error) { return {Status::Ok, std::move(jNode), {}, {0, 0}}; }
+    return {m_error.status(), std::nullopt, m_error.message(), source.getPosition()};
   } catch (const SyntaxError &ex) {
-    return {Status::SyntaxError, nullptr, ex.what(), source.getPosition()};
+    return {Status::SyntaxError, std::nullopt, ex.what(), source.getPosition()};
   } catch (const Error &ex) {
-    return {Status::UnknownError, nullptr, ex.what(), source.getPosition()};
+    return {Status::UnknownError, std::nullopt, ex.what(), source.getPosition()};
   } catch (const std::exception &ex) {
-    return {Status::UnknownError, nullptr, ex.what(), source.getPosition()};
+    return {Status::UnknownError, std::nullopt, ex.what(), source.getPosition()};
   } catch (...) {
-    return {Status::UnknownError, nullptr, "Unknown exception during parse.", source.getPosition()};
+    return {Status::UnknownError, std::nullopt, "Unknown exception during parse.", source.getPosition()};
   }
 }
 }// namespace JSON_Lib
@@ -0,0 +1,393 @@
+//
+// Class: Incremental_Parser
+//
+// Description: Resumable parser that is fed JSON a chunk at a time;
+// see Incremental_Parser.hpp.
+//
+// Dependencies: C++20 - Language standard features used.
+//
+
+#include "JSON.hpp"
+#include "JSON_Node_Core.hpp"
+#include "Incremental_Parser.hpp"
+#include "JSON_Char_Constants.hpp"
+#include "JSON_Lexer.hpp"
+#include "JSON_SpanCursor.hpp"
+#include "JSON_Throw.hpp"
+
+namespace JSON_Lib {
+
+namespace {
+  // Whitespace and the characters that end a number (as for endOfNumber())
+  constexpr std::string_view kWhiteSpace{ " \t\r\n" };
+  constexpr std::string_view kEndOfNumber{ " \t\r\n,]}" };
+  // Characters the string scan stops at
+  constexpr std::string_view kStringStops{ "\"\\" };
+  constexpr std::string_view kTrueToken{ "true" };
+  constexpr std::string_view kFalseToken{ "false" };
+  constexpr std::string_view kNullToken{ "null" };
+}// namespace
+
+/// <summary>
+/// Create a parser waiting for the first chunk of a stream.
+/// </summary>
+/// <param name="translator">Translator for string escapes.</param>
+Incremental_Parser::Incremental_Parser(std::unique_ptr<ITranslator> translator) : translator_(std::move(translator))
+{}
+/// <summary>
+/// Line/column of a byte of the current chunk, brought up from the last position
+/// worked out. Only bytes of the current chunk are ever asked for as the position
+/// is brought up to its last byte before the next chunk is parsed; an index past
+/// the end of the chunk is the end of the stream (one column past its last byte).
+/// </summary>
+/// <param name="chunk">Current chunk.</param>
+/// <param name="index">Index of the byte within the chunk.</param>
+/// <returns>Line/column of the byte.</returns>
+std::pair<long, long> Incremental_Parser::positionOf(const std::string_view &chunk, const std::size_t index)
+{
+  if (index >= chunk.size()) { return { m_position.first, m_position.second + 1 }; }
+  if (const auto offset = m_streamOffset + index; offset > m_positionOffset) {
+    const auto steps = static_cast<std::size_t>(offset - m_positionOffset);
+    const auto landed = chunk.substr(static_cast<std::size_t>(m_positionOffset + 1 - m_streamOffset), steps);
+    m_position = advancePosition(m_position, landed, steps);
+    m_positionOffset = offset;
+  }
+  return m_position;
+}
+/// <summary>
+/// Record a syntax error; the parse stops once one is recorded.
+/// </summary>
+/// <param name="message">Error message.</param>
+/// <param name="position">Line/column of the error.</param>
+void Incremental_Parser::fail(const char *message, const std::pair<long, long> &position)
+{
+  m_error.set(ParseError::Kind::syntax, message, position);
+}
+/// <summary>
+/// Text of the string/number in progress up to an index of the chunk. A token
+/// lying wholly within the chunk is a view of it; otherwise the bytes kept from
+/// earlier chunks have the rest appended.
+/// </summary>
+/// <param name="chunk">Current chunk.</param>
+/// <param name="start">Index at which the token starts (0 if in an earlier chunk).</param>
+/// <param name="end">Index of the chunk just past the token.</param>
+/// <returns>Token text.</returns>
+std::string_view
+  Incremental_Parser::tokenText(const std::string_view &chunk, const std::size_t start, const std::size_t end)
+{
+  if (m_token.empty()) { return chunk.substr(start, end - start); }
+  m_token.append(chunk.substr(start, end - start));
+  return m_token;
+}
+/// <summary>
+/// Add a complete value to the object/array it belongs to or, at the top level,
+/// queue it to be taken.
+/// </summary>
+/// <param name="jNode">Complete value.</param>
+void Incremental_Parser::completeValue(Node jNode)
+{
+  if (m_stack.empty()) {
+    m_values.push_back(std::move(jNode));
+    m_state = State::between;
+    return;
+  }
+  auto &frame = m_stack.back();
+  m_state = State::afterValue;
+  if (!frame.object) {
+    NRef<Array>(frame.jNode).add(std::move(jNode));
+  } else if (!NRef<Object>(frame.jNode).tryAdd(Object::Entry{ std::move(frame.key), std::move(jNode) })) {
+    m_error.set(ParseError::Kind::node, "Duplicate key used to add object entry.");
+  }
+}
+/// <summary>
+/// Read a complete string (or key) from its text, quotes included; the text of
+/// one not closed by the end of the stream reports the error.
+/// </summary>
+/// <param name="text">String text.</param>
+void Incremental_Parser::completeString(const std::string_view &text)
+{
+  SpanCursor cursor{ text, m_origin };
+  String extracted{ extractString(cursor, *translator_, m_error) };
+  m_token.clear();
+  if (m_error) { return; }
+  if (m_isKey) {
+    m_stack.back().key = std::move(extracted);
+    m_state = State::colon;
+  } else {
+    completeValue(Node::make<String>(std::move(extracted)));
+  }
+}
+/// <summary>
+/// Read a complete number from its text and the character that ended it (so
+/// that an invalid number is reported at that character).
+/// </summary>
+/// <param name="text">Number text.</param>
+void Incremental_Parser::completeNumber(const std::string_view &text)
+{
+  SpanCursor cursor{ text, m_origin };
+  const Number number{ extractNumber(cursor, m_error) };
+  m_token.clear();
+  if (!m_error) { completeValue(Node::make<Number>(number)); }
+}
+/// <summary>
+/// Start the value whose first character (or the end of stream) is at an index
+/// of the chunk; an object or array is opened and a token begun.
+/// </summary>
+/// <param name="chunk">Current chunk.</param>
+/// <param name="index">Index of the character.</param>
+/// <returns>Index to carry on from.</returns>
+std::size_t Incremental_Parser::startValue(const std::string_view &chunk, const std::size_t index)
+{
+  if (m_stack.size() + 1 >= m_maxParserDepth) {
+    m_error.set(ParseError::Kind::syntax, "Maximum parser depth exceeded.");
+    return index;
+  }
+  const char nextChar = index < chunk.size() ? chunk[index] : static_cast<char>(EOF);
+  switch (nextChar) {
+    case kObjectBegin:
+      m_stack.push_back({ Node::make<Object>(), String{}, true });
+      m_state = State::objectFirst;
+      return index + 1;
+    case kArrayBegin:
+      m_stack.push_back({ Node::make<Array>(), String{}, false });
+      m_state = State::arrayFirst;
+      return index + 1;
+    case kStringQuote:
+      m_isKey = false;
+      m_escape = false;
+      m_origin = positionOf(chunk, index);
+      m_state = State::string;
+      return index + 1;
+    case kStringSingleQuote:
+      fail("Missing opening '\"' on string.", positionOf(chunk, index));
+      return index;
+    case kPlus:
+    case kMinus:
+    case kZero:
+    case kOne:
+    case kTwo:
+    case kThree:
+    case kFour:
+    case kFive:
+    case kSix:
+    case kSeven:
+    case kEight:
+    case kNine:
+      m_origin = positionOf(chunk, index);
+      m_state = State::number;
+      return index;
+    case 't':
+    case 'f':
+    case 'n':
+      m_literal = nextChar == 't' ? kTrueToken : nextChar == 'f' ? kFalseToken : kNullToken;
+      m_matched = 0;
+      m_state = State::literal;
+      return index;
+    default:
+      fail("Missing String, Number, Boolean, Array, Object or Null.", positionOf(chunk, index));
+      return index;
+  }
+}
+/// <summary>
+/// Act on the next character outside of a token (or the end of stream) for
+/// the structure expected: a value, the close or first element/entry of a new
+/// array/object, a key, the ':' after it, or the ',' or close after a value.
+/// </summary>
+/// <param name="chunk">Current chunk.</param>
+/// <param name="index">Index of the character.</param>
+/// <returns>Index to carry on from.</returns>
+std::size_t Incremental_Parser::structural(const std::string_view &chunk, const std::size_t index)
+{
+  const char nextChar = index < chunk.size() ? chunk[index] : static_cast<char>(EOF);
+  const auto close = [&] {
+    Node jNode = std::move(m_stack.back().jNode);
+    m_stack.pop_back();
+    completeValue(std::move(jNode));
+    return index + 1;
+  };
+  switch (m_state) {
+    case State::arrayFirst:
+      if (nextChar == kArrayEnd) { return close(); }
+      return startValue(chunk, index);
+    case State::objectFirst:
+      if (nextChar == kObjectEnd) { return close(); }
+      [[fallthrough]];
+    case State::key:
+      if (nextChar != kStringQuote) {
+        fail("Missing opening '\"' on string.", positionOf(chunk, index));
+        return index;
+      }
+      m_isKey = true;
+      m_escape = false;
+      m_origin = positionOf(chunk, index);
+      m_state = State::string;
+      return index + 1;
+    case State::colon:
+      if (nextChar != kColon) {
+        fail("Missing ':' in key value pair.", positionOf(chunk, index));
+        return index;
+      }
+      m_state = State::value;
+      return index + 1;
+    case State::afterValue: {
+      const bool object = m_stack.back().object;
+      if (nextChar == kComma) {
+        m_state = object ? State::key : State::value;
+        return index + 1;
+      }
+      if (nextChar == (object ? kObjectEnd : kArrayEnd)) { return close(); }
+      fail(object ? "Missing closing '}' in object definition." : "Missing closing ']' in array definition.",
+        positionOf(chunk, index));
+      return index;
+    }
+    default:
+      return startValue(chunk, index);
+  }
+}
+/// <summary>
+/// Parse a chunk, carrying on from wherever the last one left off. A string or
+/// number still being read at the end of the chunk has its bytes kept for the next.
+/// </summary>
+/// <param name="chunk">Chunk of the stream.</param>
+void Incremental_Parser::parse(const std::string_view &chunk)
+{
+  // Start (within this chunk) of the token in progress
+  std::size_t start = 0;
+  std::size_t index = 0;
+  while (!m_error && index < chunk.size()) {
+    switch (m_state) {
+      case State::string:
+        if (m_escape) {
+          m_escape = false;
+          index++;
+          break;
+        }
+        index = chunk.find_first_of(kStringStops, index);
+        if (index == std::string_view::npos) {
+          index = chunk.size();
+        } else if (chunk[index++] == kEscape) {
+          m_escape = true;
+        } else {
+          completeString(tokenText(chunk, start, index));
+        }
+        break;
+      case State::number:
+        if (const auto end = chunk.find_first_of(kEndOfNumber, index); end == std::string_view::npos) {
+          index = chunk.size();
+        } else {
+          completeNumber(tokenText(chunk, start, end + 1));
+          index = end;
+        }
+        break;
+      case State::literal:
+        for (; index < chunk.size() && m_matched < m_literal.size(); index++, m_matched++) {
+          if (chunk[index] != m_literal[m_matched]) {
+            fail(m_literal == kNullToken ? "Invalid null value." : "Invalid boolean value.", positionOf(chunk, index));
+            return;
+          }
+        }
+        if (m_matched == m_literal.size()) {
+          completeValue(m_literal == kNullToken ? Node::make<Null>() : Node::make<Boolean>(m_literal == kTrueToken));
+        }
+        break;
+      default:
+        index = chunk.find_first_not_of(kWhiteSpace, index);
+        if (index == std::string_view::npos) {
+          index = chunk.size();
+        } else {
+          start = index;
+          index = structural(chunk, index);
+        }
+        break;
+    }
+  }
+  if (!m_error && (m_state == State::string || m_state == State::number)) {
+    m_token.append(chunk.substr(start));
+    // Too long a number is reported without waiting for its end
+    if (m_state == State::number && m_token.size() > kMaxNumberLength) { completeNumber(m_token); }
+  }
+}
+/// <summary>
+/// Add the next chunk of the stream, parsing as much of it as it holds.
+/// </summary>
+/// <param name="chunk">Chunk of the stream (need not outlive the call).</param>
+/// <returns>Number of complete values waiting to be taken.</returns>
+std::size_t Incremental_Parser::feed(const std::string_view &chunk)
+{
+  if (m_failed) { JSON_THROW(IParser::Error("Parser must be reset after an error.")); }
+  if (chunk.empty()) { return m_values.size(); }
+  try {
+    parse(chunk);
+  } catch (...) {
+    m_failed = true;
+    throw;
+  }
+  if (m_error) {
+    m_failed = true;
+    m_error.raise();
+  }
+  positionOf(chunk, chunk.size() - 1);
+  m_streamOffset += chunk.size();
+  return m_values.size();
+}
+/// <summary>
+/// Mark the end of the stream. A trailing number or literal is completed; an
+/// unfinished object, array, string or literal reports the same error as a
+/// parse of the stream as a whole.
+/// </summary>
+/// <returns>Number of complete values waiting to be taken.</returns>
+std::size_t Incremental_Parser::finish()
+{
+  if (m_failed) { JSON_THROW(IParser::Error("Parser must be reset after an error.")); }
+  try {
+    if (m_state == State::string) {
+      completeString(m_token);
+    } else if (m_state == State::number) {
+      completeNumber(m_token);
+    } else if (m_state == State::literal) {
+      fail(m_literal == kNullToken ? "Invalid null value." : "Invalid boolean value.", positionOf({}, 0));
+    }
+    if (!m_error && m_state != State::between) { structural({}, 0); }
+  } catch (...) {
+    m_failed = true;
+    throw;
+  }
+  if (m_error) {
+    m_failed = true;
+    m_error.raise();
+  }
+  return m_values.size();
+}
+/// <summary>
+/// Remove and return the oldest complete value.
+/// </summary>
+/// <returns>Parsed value.</returns>
+Node Incremental_Parser::take()
+{
+  if (m_values.empty()) { JSON_THROW(IParser::Error("No complete value to take.")); }
+  Node jNode = std::move(m_values.front());
+  m_values.pop_front();
+  return jNode;
+}
+/// <summary>
+/// Forget all input fed so far and any values waiting to be taken.
+/// </summary>
+void Incremental_Parser::reset()
+{
+  m_values.clear();
+  m_state = State::between;
+  m_stack.clear();
+  m_error.clear();
+  m_failed = false;
+  m_token.clear();
+  m_origin = { 1, 1 };
+  m_isKey = false;
+  m_escape = false;
+  m_literal = {};
+  m_matched = 0;
+  m_streamOffset = 0;
+  m_positionOffset = 0;
+  m_position = { 1, 1 };
+}
+
+}// namespace JSON_Lib
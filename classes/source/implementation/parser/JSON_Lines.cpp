@@ -0,0 +1,214 @@
+//
+// Class: JSON_Lines_Reader, JSON_Lines_Writer, JSON_Lines_Batch
+//
+// Description: Read and write streams of JSON documents (NDJSON/JSON Lines);
+// see JSON_Lines.hpp.
+//
+// Dependencies: C++20 - Language standard features used.
+//
+
+#include "JSON.hpp"
+#include "JSON_Node_Core.hpp"
+#include "JSON_Lines.hpp"
+#include "JSON_BufferSource.hpp"
+#include "JSON_Throw.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+namespace JSON_Lib {
+
+/// <summary>
+/// Parse the next document of the stream into a JSON instance. Parsing stops at
+/// the end of the document so the source is left at the start of the next.
+/// </summary>
+/// <param name="json">JSON instance to parse into.</param>
+/// <returns>True if a document was read, false at the end of the stream.</returns>
+bool JSON_Lines_Reader::read(JSON &json)
+{
+  source_.ignoreWS();
+  if (!source_.more()) { return false; }
+  json.parse(source_);
+  m_count++;
+  return true;
+}
+/// <summary>
+/// Parse the next document of the stream into a JSON instance without throwing.
+/// </summary>
+/// <param name="json">JSON instance to parse into.</param>
+/// <returns>Result of the parse (Status::NoData at the end of the stream).</returns>
+Result<Node> JSON_Lines_Reader::readResult(JSON &json)
+{
+  source_.ignoreWS();
+  if (!source_.more()) { return { Status::NoData, std::nullopt, {}, source_.getPosition() }; }
+  auto result = json.parseResult(source_);
+  if (result.ok()) { m_count++; }
+  return result;
+}
+/// <summary>
+/// Append a JSON instance's tree to the destination as one line.
+/// </summary>
+/// <param name="json">JSON instance to write.</param>
+void JSON_Lines_Writer::write(const JSON &json) { write(json.root()); }
+/// <summary>
+/// Append a Node to the destination as one line.
+/// </summary>
+/// <param name="jNode">Node to write.</param>
+void JSON_Lines_Writer::write(const Node &jNode)
+{
+  if (jNode.isEmpty()) { JSON_THROW(Error("No JSON to stringify.")); }
+  stringify.stringify(jNode, destination_, 0);
+  destination_.add(kLineFeed);
+  m_count++;
+}
+
+/// <summary>
+/// Create a batch parser running on a given number of worker threads.
+/// </summary>
+/// <param name="threads">Number of worker threads (0 = one per hardware thread).</param>
+JSON_Lines_Batch::JSON_Lines_Batch(const unsigned int threads)
+  : m_threads(threads != 0 ? threads : std::max(1U, std::thread::hardware_concurrency()))
+{}
+/// <summary>
+/// Split a buffer into blocks of whole lines, a few per worker so that
+/// workers finishing early can take another.
+/// </summary>
+/// <param name="buffer">Buffer of records.</param>
+/// <returns>Blocks of the buffer.</returns>
+std::vector<std::string_view> JSON_Lines_Batch::split(const std::string_view &buffer) const
+{
+  static constexpr std::size_t kBlocksPerThread = 4;
+  static constexpr std::size_t kMinBlockSize = 64 * 1024;
+  const auto blockCount =
+    std::clamp<std::size_t>(buffer.size() / kMinBlockSize, 1, static_cast<std::size_t>(m_threads) * kBlocksPerThread);
+  std::vector<std::string_view> blocks;
+  blocks.reserve(blockCount);
+  std::size_t start = 0;
+  for (std::size_t block = 1; block <= blockCount && start < buffer.size(); block++) {
+    auto end = std::max(start, buffer.size() / blockCount * block);
+    if (block == blockCount) {
+      end = buffer.size();
+    } else if (end = buffer.find(kLineFeed, end); end == std::string_view::npos) {
+      end = buffer.size();
+    } else {
+      end++;
+    }
+    blocks.push_back(buffer.substr(start, end - start));
+    start = end;
+  }
+  return blocks;
+}
+/// <summary>
+/// Parse the records of each block on the workers (the calling thread being one
+/// of them). A worker stopping at a malformed record leaves the other workers to
+/// finish only the records before it so that the first one in the buffer is the
+/// one reported; it is parsed again from the start of the buffer so that its
+/// error has the same line/column as a sequential read.
+/// </summary>
+/// <param name="buffer">Buffer of records.</param>
+/// <param name="blocks">Blocks of the buffer.</param>
+/// <param name="onRecord">Called with each record parsed.</param>
+void JSON_Lines_Batch::run(const std::string_view &buffer,
+  const std::vector<std::string_view> &blocks,
+  const BlockRecordFn &onRecord) const
+{
+  if (blocks.empty()) { return; }
+  std::atomic<std::size_t> nextBlock{ 0 };
+  std::atomic<std::size_t> firstError{ std::string_view::npos };
+  // Error (if any) that stopped each block and whether it came from the parser or onRecord
+  struct BlockError
+  {
+    std::exception_ptr error;
+    bool parseError{};
+  };
+  std::vector<BlockError> errors(blocks.size());
+  auto fail = [&](const std::size_t block, const std::size_t offset, const bool parseError) {
+    errors[block] = { std::current_exception(), parseError };
+    auto first = firstError.load();
+    while (offset < first && !firstError.compare_exchange_weak(first, offset)) {}
+  };
+  auto work = [&] {
+    Default_Translator translator;
+    Default_Parser parser{ translator };
+    parser.setMaxParserDepth(m_maxParserDepth);
+    for (auto block = nextBlock++; block < blocks.size(); block = nextBlock++) {
+      BufferSource source{ blocks[block] };
+      const auto base = static_cast<std::size_t>(blocks[block].data() - buffer.data());
+      for (source.ignoreWS(); source.more() && base + source.position() < firstError.load(); source.ignoreWS()) {
+        const auto offset = base + source.position();
+        Node record;
+        try {
+          record = parser.parse(source);
+        } catch (...) {
+          fail(block, offset, true);
+          break;
+        }
+        try {
+          onRecord(block, offset, std::move(record));
+        } catch (...) {
+          fail(block, offset, false);
+          break;
+        }
+      }
+    }
+  };
+  {
+    std::vector<std::jthread> workers;
+    const auto workerCount = std::min<std::size_t>(m_threads, blocks.size());
+    workers.reserve(workerCount - 1);
+    for (std::size_t worker = 1; worker < workerCount; worker++) { workers.emplace_back(work); }
+    work();
+  }
+  if (firstError.load() == std::string_view::npos) { return; }
+  const auto block = static_cast<std::size_t>(
+    std::ranges::find_if(blocks, [&](const std::string_view &text) {
+      return static_cast<std::size_t>(text.data() + text.size() - buffer.data()) > firstError.load();
+    })
+    - blocks.begin());
+  if (errors[block].parseError) {
+    Default_Translator translator;
+    Default_Parser parser{ translator };
+    parser.setMaxParserDepth(m_maxParserDepth);
+    BufferSource source{ buffer };
+    source.advance(firstError.load());
+    static_cast<void>(parser.parse(source));
+  }
+  std::rethrow_exception(errors[block].error);
+}
+/// <summary>
+/// Parse every record of a buffer across the workers.
+/// </summary>
+/// <param name="buffer">Buffer of NDJSON records.</param>
+/// <returns>Records in input order.</returns>
+std::vector<Node> JSON_Lines_Batch::parse(const std::string_view &buffer) const
+{
+  const auto blocks = split(buffer);
+  std::vector<std::vector<Node>> parsed(blocks.size());
+  run(buffer, blocks, [&](const std::size_t block, std::size_t, Node &&record) {
+    parsed[block].push_back(std::move(record));
+  });
+  std::size_t total = 0;
+  for (const auto &records : parsed) { total += records.size(); }
+  std::vector<Node> records;
+  records.reserve(total);
+  for (auto &blockRecords : parsed) { std::ranges::move(blockRecords, std::back_inserter(records)); }
+  return records;
+}
+/// <summary>
+/// Parse every record of a buffer across the workers, handing each on as soon as it is ready.
+/// </summary>
+/// <param name="buffer">Buffer of NDJSON records.</param>
+/// <param name="onRecord">Called (one call at a time) with each record and its byte offset.</param>
+void JSON_Lines_Batch::parse(const std::string_view &buffer, const RecordFn &onRecord) const
+{
+  std::mutex mutex;
+  run(buffer, split(buffer), [&](std::size_t, const std::size_t offset, Node &&record) {
+    const std::scoped_lock lock{ mutex };
+    onRecord(offset, std::move(record));
+  });
+}
+
+}// namespace JSON_Lib
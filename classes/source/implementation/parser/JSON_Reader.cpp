@@ -0,0 +1,315 @@
+//
+// Class: Reader
+//
+// Description: Pull reader returning the tokens of a JSON document one at
+// a time; see JSON_Reader.hpp.
+//
+// Dependencies: C++20 - Language standard features used.
+//
+
+#include "JSON.hpp"
+#include "JSON_Node_Core.hpp"
+#include "JSON_Reader.hpp"
+#include "JSON_Char_Constants.hpp"
+#include "JSON_Lexer.hpp"
+#include "JSON_Throw.hpp"
+
+namespace JSON_Lib {
+
+/// <summary>
+/// Create a reader positioned before the root value of a source.
+/// </summary>
+/// <param name="source">Source of JSON (must outlive the reader).</param>
+/// <param name="translator">Translator for string escapes.</param>
+Reader::Reader(ISource &source, std::unique_ptr<ITranslator> translator)
+  : source_(source), translator_(std::move(translator)), parser(*translator_), m_maxText(String{}.getMaxStringLength())
+{
+  restartCursor();
+}
+/// <summary>
+/// Advance the source past the bytes read through the cursor.
+/// </summary>
+void Reader::syncSource()
+{
+  if (cursor_) {
+    source_.advance(cursor_->consumed() - synced_);
+    synced_ = cursor_->consumed();
+  }
+}
+/// <summary>
+/// Read on from the source's current position, through a new cursor if its
+/// unread bytes are contiguous.
+/// </summary>
+void Reader::restartCursor()
+{
+  cursor_.reset();
+  synced_ = 0;
+  if (const auto span = source_.contiguous(); !span.empty()) { cursor_.emplace(span, source_.getPosition()); }
+}
+/// <summary>
+/// Run a read over the cursor (if any) or the source. On an error the source is
+/// left where character-by-character parsing would have stopped so that it reports
+/// the same line/column.
+/// </summary>
+/// <param name="readFn">Read to run (called with the cursor or the source).</param>
+/// <returns>Result of the read.</returns>
+template<typename Read> auto Reader::read(Read readFn)
+{
+  if (!cursor_) { return readFn(source_); }
+  try {
+    return readFn(*cursor_);
+  } catch (...) {
+    source_.advance(cursor_->errorOffset() - synced_);
+    synced_ = cursor_->errorOffset();
+    throw;
+  }
+}
+/// <summary>
+/// Read a value (as parseNodes() does); objects and arrays are just opened.
+/// </summary>
+/// <param name="source">Source of JSON.</param>
+/// <returns>Token read.</returns>
+template<typename Source> Reader::Token Reader::readValue(Source &source)
+{
+  static constexpr std::string_view kTrueToken{ "true" };
+  static constexpr std::string_view kFalseToken{ "false" };
+  static constexpr std::string_view kNullToken{ "null" };
+  if (m_open.size() + 1 >= parser.getMaxParserDepth()) { JSON_THROW(SyntaxError("Maximum parser depth exceeded.")); }
+  source.ignoreWS();
+  Token token{ Token::none };
+  switch (source.current()) {
+    case JSON_Lib::kObjectBegin:
+    case JSON_Lib::kArrayBegin:
+      m_open.push_back(source.current() == JSON_Lib::kObjectBegin);
+      m_expect = m_open.back() ? Expect::firstEntry : Expect::firstElement;
+      source.next();
+      source.ignoreWS();
+      return m_open.back() ? Token::objectStart : Token::arrayStart;
+    case JSON_Lib::kStringQuote:
+    case JSON_Lib::kStringSingleQuote:
+      m_text = extractText(source, *translator_, m_buffer, m_maxText);
+      token = Token::string;
+      break;
+    case JSON_Lib::kPlus:
+    case JSON_Lib::kMinus:
+    case JSON_Lib::kZero:
+    case JSON_Lib::kOne:
+    case JSON_Lib::kTwo:
+    case JSON_Lib::kThree:
+    case JSON_Lib::kFour:
+    case JSON_Lib::kFive:
+    case JSON_Lib::kSix:
+    case JSON_Lib::kSeven:
+    case JSON_Lib::kEight:
+    case JSON_Lib::kNine:
+      m_number = extractNumber(source);
+      token = Token::number;
+      break;
+    case 't':
+    case 'f':
+      if (source.match(kTrueToken)) {
+        m_boolean = true;
+      } else if (source.match(kFalseToken)) {
+        m_boolean = false;
+      } else {
+        JSON_THROW(SyntaxError(source.getPosition(), "Invalid boolean value."));
+      }
+      token = Token::boolean;
+      break;
+    case 'n':
+      if (!source.match(kNullToken)) { JSON_THROW(SyntaxError(source.getPosition(), "Invalid null value.")); }
+      token = Token::null;
+      break;
+    default:
+      JSON_THROW(SyntaxError(source.getPosition(), "Missing String, Number, Boolean, Array, Object or Null."));
+  }
+  source.ignoreWS();
+  m_expect = m_open.empty() ? Expect::end : Expect::separator;
+  return token;
+}
+/// <summary>
+/// Read an object key and the ':' that follows it (as parseObjectEntry() does).
+/// </summary>
+/// <param name="source">Source of JSON.</param>
+/// <returns>Key token.</returns>
+template<typename Source> Reader::Token Reader::readKey(Source &source)
+{
+  source.ignoreWS();
+  m_text = extractText(source, *translator_, m_buffer, m_maxText);
+  source.ignoreWS();
+  if (source.current() != JSON_Lib::kColon) {
+    JSON_THROW(SyntaxError(source.getPosition(), "Missing ':' in key value pair."));
+  }
+  source.next();
+  m_expect = Expect::value;
+  return Token::key;
+}
+/// <summary>
+/// Close the innermost object/array (as parseCollection() does).
+/// </summary>
+/// <param name="source">Source of JSON.</param>
+/// <returns>End token.</returns>
+template<typename Source> Reader::Token Reader::closeCollection(Source &source)
+{
+  const bool object = m_open.back();
+  if (object && source.current() != JSON_Lib::kObjectEnd) {
+    JSON_THROW(SyntaxError(source.getPosition(), "Missing closing '}' in object definition."));
+  }
+  if (!object && source.current() != JSON_Lib::kArrayEnd) {
+    JSON_THROW(SyntaxError(source.getPosition(), "Missing closing ']' in array definition."));
+  }
+  source.next();
+  m_open.pop_back();
+  source.ignoreWS();
+  m_expect = m_open.empty() ? Expect::end : Expect::separator;
+  return object ? Token::objectEnd : Token::arrayEnd;
+}
+/// <summary>
+/// Read the next token for where the reader is in the grammar.
+/// </summary>
+/// <param name="source">Source of JSON.</param>
+/// <returns>Token read.</returns>
+template<typename Source> Reader::Token Reader::step(Source &source)
+{
+  switch (m_expect) {
+    case Expect::value:
+      return readValue(source);
+    case Expect::firstEntry:
+      if (source.current() == JSON_Lib::kObjectEnd) { return closeCollection(source); }
+      return readKey(source);
+    case Expect::firstElement:
+      if (source.current() == JSON_Lib::kArrayEnd) { return closeCollection(source); }
+      return readValue(source);
+    case Expect::separator:
+      if (source.current() == JSON_Lib::kComma) {
+        source.next();
+        return m_open.back() ? readKey(source) : readValue(source);
+      }
+      return closeCollection(source);
+    case Expect::end:
+    default:
+      return Token::end;
+  }
+}
+/// <summary>
+/// Move up to the start of the next value if one comes next.
+/// </summary>
+/// <param name="source">Source of JSON.</param>
+/// <returns>True if a value follows.</returns>
+template<typename Source> bool Reader::valueFollows(Source &source)
+{
+  if (m_expect == Expect::firstElement && source.current() != JSON_Lib::kArrayEnd) { m_expect = Expect::value; }
+  if (m_expect == Expect::separator && !m_open.back() && source.current() == JSON_Lib::kComma) {
+    source.next();
+    m_expect = Expect::value;
+  }
+  return m_expect == Expect::value;
+}
+/// <summary>
+/// Read the next token of the document.
+/// </summary>
+/// <returns>Token read (Token::end once the root value is complete).</returns>
+Reader::Token Reader::next()
+{
+  m_token = read([this](auto &source) { return step(source); });
+  if (m_token == Token::end) { syncSource(); }
+  return m_token;
+}
+/// <summary>
+/// Move up to the next quote, bracket or brace (or the end of the source).
+/// </summary>
+/// <param name="source">Source of JSON.</param>
+template<typename Source> void skipToStructural(Source &source)
+{
+  static constexpr std::string_view kStructural{ R"("{}[])" };
+  if constexpr (std::is_same_v<Source, SpanCursor>) {
+    const auto remaining = source.remaining();
+    source.advance(std::min(remaining.find_first_of(kStructural), remaining.size()));
+  } else {
+    while (source.more() && kStructural.find(source.current()) == std::string_view::npos) { source.next(); }
+  }
+}
+/// <summary>
+/// Pass over the rest of the innermost open object/array by matching its
+/// brackets and braces and stepping over strings, without reading the tokens
+/// in between. Nesting still counts against the maximum depth.
+/// </summary>
+/// <param name="source">Source of JSON.</param>
+/// <returns>End token of the collection.</returns>
+template<typename Source> Reader::Token Reader::skipCollection(Source &source)
+{
+  const auto depth = m_open.size();
+  Token token{ Token::none };
+  while (m_open.size() >= depth) {
+    skipToStructural(source);
+    switch (source.current()) {
+      case JSON_Lib::kStringQuote:
+        skipText(source);
+        break;
+      case JSON_Lib::kObjectBegin:
+      case JSON_Lib::kArrayBegin:
+        if (m_open.size() + 1 >= parser.getMaxParserDepth()) {
+          JSON_THROW(SyntaxError("Maximum parser depth exceeded."));
+        }
+        m_open.push_back(source.current() == JSON_Lib::kObjectBegin);
+        source.next();
+        break;
+      default:
+        // A closing bracket/brace, or the end of the source which closeCollection() reports
+        token = closeCollection(source);
+    }
+  }
+  return token;
+}
+/// <summary>
+/// Skip the value of the key just read, or the rest of the object/array just
+/// started. Objects and arrays are passed over structurally and a string
+/// value is stepped over without being decoded, so what lies inside is not
+/// checked beyond its brackets, braces and quotes. Afterwards token() is the
+/// end token of a skipped object/array or Token::none for a skipped string.
+/// </summary>
+void Reader::skip()
+{
+  m_token = read([this](auto &source) {
+    Token token{ m_token };
+    if (token == Token::key) {
+      source.ignoreWS();
+      if (source.current() == JSON_Lib::kStringQuote) {
+        skipText(source);
+        source.ignoreWS();
+        m_expect = Expect::separator;
+        return Token::none;
+      }
+      token = readValue(source);
+    }
+    if (token == Token::objectStart || token == Token::arrayStart) { token = skipCollection(source); }
+    return token;
+  });
+}
+/// <summary>
+/// Parse the next value into a Node with Default_Parser; the depth limit
+/// still counts the objects/arrays the reader has open.
+/// </summary>
+/// <returns>Parsed value (empty Node if no value comes next).</returns>
+Node Reader::value()
+{
+  if (!read([this](auto &source) { return valueFollows(source); })) { return Node{}; }
+  syncSource();
+  const auto maxDepth = parser.getMaxParserDepth();
+  parser.setMaxParserDepth(maxDepth - m_open.size());
+  Node jNode;
+  try {
+    jNode = parser.parse(source_);
+  } catch (...) {
+    parser.setMaxParserDepth(maxDepth);
+    restartCursor();
+    throw;
+  }
+  parser.setMaxParserDepth(maxDepth);
+  restartCursor();
+  m_expect = m_open.empty() ? Expect::end : Expect::separator;
+  m_token = Token::none;
+  return jNode;
+}
+
+}// namespace JSON_Lib
@@ -0,0 +1,538 @@
+//
+// Class: Structural_Parser
+//
+// Description: Two-stage JSON parser for contiguous input. Stage one
+// classifies 64 byte blocks into bit masks (quotes, backslashes, white
+// space and structural characters) and from them builds an index of
+// every structural character, opening quote and scalar start outside
+// of strings. Stage two walks the index building the Node tree. The
+// index is built a chunk at a time on demand so that memory use stays
+// bounded and a document followed by more input (e.g. a stream of
+// documents) only pays for what it uses.
+//
+// Dependencies: C++20 - Language standard features used.
+//
+
+#include "JSON.hpp"
+#include "JSON_Node_Core.hpp"
+#include "Structural_Parser.hpp"
+#include "JSON_Char_Constants.hpp"
+#include "JSON_Escapes.hpp"
+
+#include <array>
+#include <bit>
+#include <cstring>
+#include <string_view>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define JSON_LIB_STRUCTURAL_SSE2 1
+#include <immintrin.h>
+#if defined(__GNUC__) || defined(__clang__)
+#define JSON_LIB_STRUCTURAL_AVX2 1
+#endif
+#endif
+
+namespace JSON_Lib {
+
+namespace {
+
+constexpr std::size_t kBlockSize = 64;
+// Blocks classified per index fill (16K of input)
+constexpr std::size_t kBlocksPerChunk = 256;
+
+// Per-block classification masks; bit n corresponds to byte n of the block.
+struct BlockMasks
+{
+  uint64_t quote;
+  uint64_t backslash;
+  uint64_t whitespace;
+  uint64_t structural;
+};
+
+using ClassifyFn = BlockMasks (*)(const char *block);
+
+/// <summary>
+/// Classify a 64 byte block one character at a time.
+/// </summary>
+/// <param name="block">Start of block.</param>
+/// <returns>Block classification masks.</returns>
+BlockMasks classifyScalar(const char *block)
+{
+  BlockMasks masks{};
+  for (std::size_t index = 0; index < kBlockSize; index++) {
+    const uint64_t bit = uint64_t{ 1 } << index;
+    switch (block[index]) {
+      case kStringQuote:
+        masks.quote |= bit;
+        break;
+      case kEscape:
+        masks.backslash |= bit;
+        break;
+      case kSpace:
+      case kTab:
+      case kLineFeed:
+      case kCarriageReturn:
+        masks.whitespace |= bit;
+        break;
+      case kObjectBegin:
+      case kObjectEnd:
+      case kArrayBegin:
+      case kArrayEnd:
+      case kColon:
+      case kComma:
+        masks.structural |= bit;
+        break;
+      default:
+        break;
+    }
+  }
+  return masks;
+}
+
+#if JSON_LIB_STRUCTURAL_SSE2
+/// <summary>
+/// Classify a 64 byte block 16 bytes at a time using SSE2 compares.
+/// </summary>
+/// <param name="block">Start of block.</param>
+/// <returns>Block classification masks.</returns>
+BlockMasks classifySSE2(const char *block)
+{
+  BlockMasks masks{};
+  for (std::size_t lane = 0; lane < kBlockSize; lane += 16) {
+    const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(block + lane));
+    const auto is = [&chunk](const char ch) { return _mm_cmpeq_epi8(chunk, _mm_set1_epi8(ch)); };
+    const auto bits = [lane](const __m128i matched) {
+      return static_cast<uint64_t>(static_cast<uint32_t>(_mm_movemask_epi8(matched))) << lane;
+    };
+    masks.quote |= bits(is(kStringQuote));
+    masks.backslash |= bits(is(kEscape));
+    masks.whitespace |= bits(
+      _mm_or_si128(_mm_or_si128(is(kSpace), is(kTab)), _mm_or_si128(is(kLineFeed), is(kCarriageReturn))));
+    masks.structural |= bits(_mm_or_si128(_mm_or_si128(_mm_or_si128(is(kObjectBegin), is(kObjectEnd)),
+                                            _mm_or_si128(is(kArrayBegin), is(kArrayEnd))),
+      _mm_or_si128(is(kColon), is(kComma))));
+  }
+  return masks;
+}
+#endif
+
+#if JSON_LIB_STRUCTURAL_AVX2
+/// <summary>
+/// Classify a 64 byte block 32 bytes at a time using AVX2 compares. Only
+/// called once the CPU has been checked for AVX2 support.
+/// </summary>
+/// <param name="block">Start of block.</param>
+/// <returns>Block classification masks.</returns>
+__attribute__((target("avx2"))) BlockMasks classifyAVX2(const char *block)
+{
+  BlockMasks masks{};
+  for (std::size_t lane = 0; lane < kBlockSize; lane += 32) {
+    const __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(block + lane));
+    // Lambdas do not inherit the target attribute, so the compares are spelt out
+    const __m256i quote = _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8(kStringQuote));
+    const __m256i backslash = _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8(kEscape));
+    const __m256i whitespace = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(chunk, _mm256_set1_epi8(kSpace)),
+                                                 _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8(kTab))),
+      _mm256_or_si256(_mm256_cmpeq_epi8(chunk, _mm256_set1_epi8(kLineFeed)),
+        _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8(kCarriageReturn))));
+    const __m256i structural =
+      _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(chunk, _mm256_set1_epi8(kObjectBegin)),
+                                        _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8(kObjectEnd))),
+                        _mm256_or_si256(_mm256_cmpeq_epi8(chunk, _mm256_set1_epi8(kArrayBegin)),
+                          _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8(kArrayEnd)))),
+        _mm256_or_si256(
+          _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8(kColon)), _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8(kComma))));
+    masks.quote |= static_cast<uint64_t>(static_cast<uint32_t>(_mm256_movemask_epi8(quote))) << lane;
+    masks.backslash |= static_cast<uint64_t>(static_cast<uint32_t>(_mm256_movemask_epi8(backslash))) << lane;
+    masks.whitespace |= static_cast<uint64_t>(static_cast<uint32_t>(_mm256_movemask_epi8(whitespace))) << lane;
+    masks.structural |= static_cast<uint64_t>(static_cast<uint32_t>(_mm256_movemask_epi8(structural))) << lane;
+  }
+  return masks;
+}
+#endif
+
+/// <summary>
+/// Return mask of characters escaped by a preceding backslash. Backslashes are
+/// rare so they are visited individually in ascending order; a backslash that
+/// is itself escaped escapes nothing.
+/// </summary>
+/// <param name="backslash">Block backslash mask.</param>
+/// <param name="carry">In: first byte of block is escaped; Out: first byte of next block is.</param>
+/// <returns>Escaped character mask.</returns>
+uint64_t escapedMask(uint64_t backslash, uint64_t &carry)
+{
+  uint64_t escaped = carry;
+  carry = 0;
+  while (backslash != 0) {
+    const uint64_t bit = backslash & (~backslash + 1);
+    if ((escaped & bit) == 0) {
+      if (bit == uint64_t{ 1 } << (kBlockSize - 1)) {
+        carry = 1;
+      } else {
+        escaped |= bit << 1;
+      }
+    }
+    backslash &= backslash - 1;
+  }
+  return escaped;
+}
+/// <summary>
+/// Running XOR of the bits in a mask; applied to the quote mask it yields a mask
+/// covering each string from its opening quote up to (not including) its closing one.
+/// </summary>
+/// <param name="mask">Input mask.</param>
+/// <returns>Prefix XOR of mask.</returns>
+uint64_t prefixXor(uint64_t mask)
+{
+  mask ^= mask << 1;
+  mask ^= mask << 2;
+  mask ^= mask << 4;
+  mask ^= mask << 8;
+  mask ^= mask << 16;
+  mask ^= mask << 32;
+  return mask;
+}
+
+// ============================================================
+// Stage one: structural index built on demand over the input
+// ============================================================
+class StructuralIndex
+{
+public:
+  StructuralIndex(const std::string_view &input, const ClassifyFn classify, std::vector<std::size_t> &entries)
+    : input(input), classify(classify), entries(entries)
+  {
+    entries.clear();
+  }
+  // Offset of the next index entry (npos once the input is exhausted)
+  std::size_t peek()
+  {
+    while (nextEntry == entries.size()) {
+      if (!fill()) { return std::string_view::npos; }
+    }
+    return entries[nextEntry];
+  }
+  void pop() noexcept { nextEntry++; }
+
+private:
+  // Classify the next chunk of input; false when there is none left
+  bool fill()
+  {
+    if (scanned >= input.size()) { return false; }
+    entries.clear();
+    nextEntry = 0;
+    for (std::size_t block = 0; block < kBlocksPerChunk && scanned < input.size(); block++) {
+      const char *blockStart = input.data() + scanned;
+      std::array<char, kBlockSize> padded;
+      if (input.size() - scanned < kBlockSize) {
+        padded.fill(kSpace);
+        std::memcpy(padded.data(), blockStart, input.size() - scanned);
+        blockStart = padded.data();
+      }
+      const BlockMasks masks = classify(blockStart);
+      const uint64_t quotes = masks.quote & ~escapedMask(masks.backslash, escapeCarry);
+      const uint64_t inString = prefixXor(quotes) ^ stringCarry;
+      stringCarry = inString >> (kBlockSize - 1) != 0 ? ~uint64_t{ 0 } : 0;
+      const uint64_t scalar = ~(masks.whitespace | masks.structural | quotes | inString);
+      const uint64_t scalarStarts = scalar & ~(scalar << 1 | scalarCarry);
+      scalarCarry = scalar >> (kBlockSize - 1);
+      uint64_t starts = (masks.structural & ~inString) | (quotes & inString) | scalarStarts;
+      while (starts != 0) {
+        entries.push_back(scanned + static_cast<std::size_t>(std::countr_zero(starts)));
+        starts &= starts - 1;
+      }
+      scanned += kBlockSize;
+    }
+    return true;
+  }
+
+  std::string_view input;
+  ClassifyFn classify;
+  std::vector<std::size_t> &entries;
+  std::size_t nextEntry{};
+  std::size_t scanned{};
+  // State carried from one block to the next
+  uint64_t escapeCarry{};
+  uint64_t stringCarry{};
+  uint64_t scalarCarry{};
+};
+
+// ============================================================
+// Stage two: build Node tree from the structural index. Any
+// input not accepted here is reparsed by Default_Parser, so
+// each step only reports success or failure (nothing is thrown
+// for malformed input).
+// ============================================================
+class TreeBuilder
+{
+public:
+  TreeBuilder(const std::string_view &input,
+    StructuralIndex &index,
+    const ITranslator &translator,
+    const unsigned long maxDepth,
+    const bool borrow)
+    : input(input), index(index), translator(translator), maxDepth(maxDepth), borrow(borrow)
+  {
+  }
+  // Parse the root value; on success returns the number of bytes consumed
+  bool parseRoot(Node &root, std::size_t &consumed)
+  {
+    if (!parseValue(root, 1)) { return false; }
+    consumed = skipWS(valueEnd);
+    return true;
+  }
+
+private:
+  JSON_LIB_NODISCARD static bool isWS(const char ch) noexcept
+  {
+    return ch == kSpace || ch == kTab || ch == kLineFeed || ch == kCarriageReturn;
+  }
+  JSON_LIB_NODISCARD std::size_t skipWS(std::size_t offset) const noexcept
+  {
+    while (offset < input.size() && isWS(input[offset])) { offset++; }
+    return offset;
+  }
+  // Consume next index entry if it is the given character
+  bool expect(const char ch)
+  {
+    const auto offset = index.peek();
+    if (offset == std::string_view::npos || input[offset] != ch) { return false; }
+    index.pop();
+    valueEnd = offset + 1;
+    return true;
+  }
+  bool parseValue(Node &value, const unsigned long depth)
+  {
+    if (depth >= maxDepth) { return false; }
+    const auto offset = index.peek();
+    if (offset == std::string_view::npos) { return false; }
+    index.pop();
+    switch (input[offset]) {
+      case kObjectBegin:
+        return parseObject(value, depth);
+      case kArrayBegin:
+        return parseArray(value, depth);
+      case kStringQuote: {
+        String string;
+        if (!extractString(offset, string)) { return false; }
+        value = Node::make<String>(std::move(string));
+        return true;
+      }
+      default:
+        return parseScalar(value, offset);
+    }
+  }
+  bool parseObject(Node &object, const unsigned long depth)
+  {
+    object = Node::make<Object>();
+    if (expect(kObjectEnd)) { return true; }
+    do {
+      const auto keyOffset = index.peek();
+      if (!expect(kStringQuote)) { return false; }
+      String key;
+      if (!extractString(keyOffset, key) || !expect(kColon)) { return false; }
+      Node value;
+      if (!parseValue(value, depth + 1)) { return false; }
+      if (!NRef<Object>(object).tryAdd(Object::Entry(std::move(key), std::move(value)))) { return false; }
+    } while (expect(kComma));
+    return expect(kObjectEnd);
+  }
+  bool parseArray(Node &array, const unsigned long depth)
+  {
+    array = Node::make<Array>();
+    if (expect(kArrayEnd)) { return true; }
+    do {
+      Node element;
+      if (!parseValue(element, depth + 1)) { return false; }
+      NRef<Array>(array).add(std::move(element));
+    } while (expect(kComma));
+    return expect(kArrayEnd);
+  }
+  // Decode string whose opening quote is at offset (same escape handling as Default_Parser).
+  // When borrowing, a string without escapes references the input.
+  bool extractString(const std::size_t quote, String &extracted)
+  {
+    std::size_t offset = quote + 1;
+    std::size_t escapes = 0;
+    while (true) {
+      offset = input.find_first_of(R"("\)", offset);
+      if (offset == std::string_view::npos) { return false; }
+      if (input[offset] == kStringQuote) { break; }
+      escapes++;
+      offset += 2;
+    }
+    const std::string_view raw{ input.substr(quote + 1, offset - quote - 1) };
+    if (raw.size() - escapes > extracted.getMaxStringLength()) { return false; }
+    valueEnd = offset + 1;
+    if (borrow && escapes == 0) {
+      extracted = String::borrow(raw);
+    } else if (escapes == 0) {
+      extracted = String{ raw };
+    } else {
+      std::string unescaped;
+      if (const char *message = nullptr; !tryUnescapeString(raw, translator, unescaped, message)) { return false; }
+      extracted = String{ unescaped };
+    }
+    return true;
+  }
+  // Number, boolean or null starting at offset; the token runs to the same
+  // terminators Default_Parser uses for numbers.
+  bool parseScalar(Node &scalar, const std::size_t offset)
+  {
+    std::size_t end = offset;
+    while (end < input.size() && !isWS(input[end]) && input[end] != kComma && input[end] != kArrayEnd
+           && input[end] != kObjectEnd) {
+      end++;
+    }
+    const std::string_view token{ input.substr(offset, end - offset) };
+    valueEnd = end;
+    if (token.empty()) { return false; }
+    switch (token.front()) {
+      case 't':
+        scalar = Node::make<Boolean>(true);
+        return token == "true";
+      case 'f':
+        scalar = Node::make<Boolean>(false);
+        return token == "false";
+      case 'n':
+        scalar = Node::make<Null>();
+        return token == "null";
+      case kPlus:
+      case kMinus:
+      case kZero:
+      case kOne:
+      case kTwo:
+      case kThree:
+      case kFour:
+      case kFive:
+      case kSix:
+      case kSeven:
+      case kEight:
+      case kNine: {
+        static constexpr std::size_t kMaxNumberLength = 64;
+        if (token.size() >= kMaxNumberLength) { return false; }
+        const Number number{ token };
+        if (!number.isValid()) { return false; }
+        scalar = Node::make<Number>(number);
+        return true;
+      }
+      default:
+        return false;
+    }
+  }
+
+  std::string_view input;
+  StructuralIndex &index;
+  const ITranslator &translator;
+  unsigned long maxDepth;
+  // Strings reference the input rather than being copied
+  bool borrow;
+  // Offset just past the last value or structural consumed
+  std::size_t valueEnd{};
+};
+
+}// namespace
+
+/// <summary>
+/// Construct parser taking ownership of the string translator.
+/// </summary>
+/// <param name="translator">String translator.</param>
+/// <param name="kernel">Stage one classification kernel.</param>
+Structural_Parser::Structural_Parser(std::unique_ptr<ITranslator> translator, const Kernel kernel)
+  : translator_(std::move(translator)), fallback(*translator_)
+{
+  setKernel(kernel);
+}
+/// <summary>
+/// Is a stage one kernel available on this build and CPU ?
+/// </summary>
+/// <param name="kernel">Stage one classification kernel.</param>
+/// <returns>True if kernel may be used.</returns>
+bool Structural_Parser::isKernelSupported(const Kernel kernel) noexcept
+{
+  switch (kernel) {
+    case Kernel::automatic:
+    case Kernel::scalar:
+      return true;
+#if JSON_LIB_STRUCTURAL_SSE2
+    case Kernel::sse2:
+      return true;
+#endif
+#if JSON_LIB_STRUCTURAL_AVX2
+    case Kernel::avx2:
+      return __builtin_cpu_supports("avx2") != 0;
+#endif
+    default:
+      return false;
+  }
+}
+/// <summary>
+/// Select stage one kernel; automatic (or an unsupported kernel) picks the widest available.
+/// </summary>
+/// <param name="kernel">Stage one classification kernel.</param>
+void Structural_Parser::setKernel(const Kernel kernel) noexcept
+{
+  if (kernel != Kernel::automatic && isKernelSupported(kernel)) {
+    m_kernel = kernel;
+  } else if (isKernelSupported(Kernel::avx2)) {
+    m_kernel = Kernel::avx2;
+  } else if (isKernelSupported(Kernel::sse2)) {
+    m_kernel = Kernel::sse2;
+  } else {
+    m_kernel = Kernel::scalar;
+  }
+}
+/// <summary>
+/// Parse contiguous JSON through the structural index. Nothing is thrown for
+/// input that it does not accept; false is returned for it to be reparsed.
+/// </summary>
+/// <param name="source">Source of JSON.</param>
+/// <param name="span">Unread bytes of the source.</param>
+/// <param name="root">Root Node parsed.</param>
+/// <returns>True if the input was parsed (and the source advanced past it).</returns>
+bool Structural_Parser::parseIndexed(ISource &source, const std::string_view &span, Node &root)
+{
+  ClassifyFn classify = classifyScalar;
+#if JSON_LIB_STRUCTURAL_SSE2
+  if (m_kernel == Kernel::sse2) { classify = classifySSE2; }
+#endif
+#if JSON_LIB_STRUCTURAL_AVX2
+  if (m_kernel == Kernel::avx2) { classify = classifyAVX2; }
+#endif
+  StructuralIndex index{ span, classify, m_index };
+  TreeBuilder builder{ span, index, *translator_, fallback.getMaxParserDepth(), fallback.getBorrowedStrings() };
+  if (std::size_t consumed = 0; builder.parseRoot(root, consumed)) {
+    source.advance(consumed);
+    return true;
+  }
+  return false;
+}
+/// <summary>
+/// Parse JSON source producing a Node structure representation of it. Contiguous
+/// sources go through the structural index; anything else, or any input that it
+/// does not accept, is parsed by Default_Parser so results and errors match it.
+/// </summary>
+/// <param name="source">Source of JSON.</param>
+/// <returns>Root Node.</returns>
+Node Structural_Parser::parse(ISource &source)
+{
+  const auto span = source.contiguous();
+  if (Node root; !span.empty() && parseIndexed(source, span, root)) { return root; }
+  return fallback.parse(source);
+}
+/// <summary>
+/// Parse JSON source as parse() does, reporting rather than throwing errors in
+/// it; input the structural index does not accept goes to Default_Parser's
+/// parseResult(), so no exception is thrown for malformed JSON either way.
+/// </summary>
+/// <param name="source">Source of JSON.</param>
+/// <returns>Root Node or the error.</returns>
+Result<Node> Structural_Parser::parseResult(ISource &source)
+{
+  const auto span = source.contiguous();
+  if (Node root; !span.empty() && parseIndexed(source, span, root)) {
+    return { Status::Ok, std::move(root), {}, { 0, 0 } };
+  }
+  return fallback.parseResult(source);
+}
+}// namespace JSON_Lib
@@ -0,0 +1,241 @@
+//
+// Class: JSON_Impl_Strip
+//
+// Description: JSON class implementation layer to strip the whitespace
+// from JSON text. Text is scanned a block at a time (sixteen bytes per
+// step where SSE2 is available) for whitespace and string boundaries,
+// and everything between runs of whitespace is passed on as one write.
+// Sources held in contiguous memory are scanned in place; others are
+// read a fixed size block at a time so memory use does not depend on
+// the size of the input.
+//
+// Dependencies: C++20 - Language standard features used.
+//
+
+#include "JSON_Impl.hpp"
+#include "JSON_StringifyBuffer.hpp"
+#include "JSON_Throw.hpp"
+
+#include <array>
+#include <bit>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define JSON_LIB_STRIP_SSE2 1
+#include <emmintrin.h>
+#endif
+
+namespace JSON_Lib {
+
+// Characters read per block from sources not held in contiguous memory
+#if JSON_LIB_EMBEDDED
+constexpr std::size_t kStripBlockSize{ 256 };
+#else
+constexpr std::size_t kStripBlockSize{ 16 * 1024 };
+#endif
+
+// ========================================
+// Strip state carried from block to block
+// ========================================
+struct StripState
+{
+  bool inString{};
+  bool escaped{};
+};
+
+// ===============================================================
+// Events for validation that reject a key repeated within an
+// object, as adding it to the object while building a tree does.
+// Only the keys of the objects open at the time are held.
+// ===============================================================
+class DuplicateKeyCheck final : public IEvents
+{
+public:
+  void onObjectStart() override { keys.emplace_back(); }
+  void onObjectEnd() override { keys.pop_back(); }
+  void onKey(const std::string_view &key) override
+  {
+    if (!keys.back().emplace(key).second) { JSON_THROW(Node::Error("Duplicate key used to add object entry.")); }
+  }
+
+private:
+  std::vector<std::unordered_set<std::string>> keys;
+};
+
+/// <summary>
+/// Is a character JSON whitespace.
+/// </summary>
+/// <param name="ch">Character.</param>
+/// <returns>==true then whitespace.</returns>
+constexpr bool isWhiteSpace(const char ch) { return ch == ' ' || ch == '\t' || ch == '\n' || ch == '\r'; }
+/// <summary>
+/// Return index of the first whitespace character or '"' at or after a
+/// given index (block size if there is none).
+/// </summary>
+/// <param name="block">Block of JSON text.</param>
+/// <param name="next">Index to start at.</param>
+/// <returns>Index of character found.</returns>
+std::size_t findWhiteSpaceOrQuote(const std::string_view &block, std::size_t next)
+{
+#if JSON_LIB_STRIP_SSE2
+  // Any byte up to ' ' (unsigned) is a candidate; the scalar loop below confirms it
+  const __m128i space = _mm_set1_epi8(' ');
+  const __m128i quote = _mm_set1_epi8('"');
+  for (; next + 16 <= block.size(); next += 16) {
+    const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(block.data() + next));
+    const __m128i low = _mm_cmpeq_epi8(_mm_min_epu8(chunk, space), chunk);
+    if (const int mask = _mm_movemask_epi8(_mm_or_si128(low, _mm_cmpeq_epi8(chunk, quote))); mask != 0) {
+      next += static_cast<std::size_t>(std::countr_zero(static_cast<unsigned>(mask)));
+      break;
+    }
+  }
+#endif
+  while (next < block.size() && block[next] != '"' && !isWhiteSpace(block[next])) { next++; }
+  return next;
+}
+/// <summary>
+/// Return index of the first '"' or '\' at or after a given index (block
+/// size if there is none).
+/// </summary>
+/// <param name="block">Block of JSON text.</param>
+/// <param name="next">Index to start at.</param>
+/// <returns>Index of character found.</returns>
+std::size_t findQuoteOrEscape(const std::string_view &block, std::size_t next)
+{
+#if JSON_LIB_STRIP_SSE2
+  const __m128i quote = _mm_set1_epi8('"');
+  const __m128i escape = _mm_set1_epi8('\\');
+  for (; next + 16 <= block.size(); next += 16) {
+    const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(block.data() + next));
+    const __m128i found = _mm_or_si128(_mm_cmpeq_epi8(chunk, quote), _mm_cmpeq_epi8(chunk, escape));
+    if (const int mask = _mm_movemask_epi8(found); mask != 0) {
+      return next + static_cast<std::size_t>(std::countr_zero(static_cast<unsigned>(mask)));
+    }
+  }
+#endif
+  while (next < block.size() && block[next] != '"' && block[next] != '\\') { next++; }
+  return next;
+}
+/// <summary>
+/// Return index of the first character that is not whitespace at or after
+/// a given index (block size if there is none).
+/// </summary>
+/// <param name="block">Block of JSON text.</param>
+/// <param name="next">Index to start at.</param>
+/// <returns>Index of character found.</returns>
+std::size_t skipWhiteSpace(const std::string_view &block, std::size_t next)
+{
+#if JSON_LIB_STRIP_SSE2
+  for (; next + 16 <= block.size(); next += 16) {
+    const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(block.data() + next));
+    const __m128i whiteSpace = _mm_or_si128(
+      _mm_or_si128(_mm_cmpeq_epi8(chunk, _mm_set1_epi8(' ')), _mm_cmpeq_epi8(chunk, _mm_set1_epi8('\t'))),
+      _mm_or_si128(_mm_cmpeq_epi8(chunk, _mm_set1_epi8('\n')), _mm_cmpeq_epi8(chunk, _mm_set1_epi8('\r'))));
+    if (const int mask = _mm_movemask_epi8(whiteSpace); mask != 0xFFFF) {
+      return next + static_cast<std::size_t>(std::countr_zero(static_cast<unsigned>(~mask)));
+    }
+  }
+#endif
+  while (next < block.size() && isWhiteSpace(block[next])) { next++; }
+  return next;
+}
+/// <summary>
+/// Strip the whitespace outside of strings from a block of JSON text,
+/// passing each run of characters between whitespace to the destination
+/// in one add(). A string or escape left open at the end of the block is
+/// recorded in the strip state for the next.
+/// </summary>
+/// <param name="block">Block of JSON text.</param>
+/// <param name="state">Strip state.</param>
+/// <param name="destination">Destination for stripped JSON.</param>
+void stripBlock(const std::string_view &block, StripState &state, IDestination &destination)
+{
+  std::size_t run = 0;
+  std::size_t next = 0;
+  while (next < block.size()) {
+    if (state.escaped) {
+      state.escaped = false;
+      next++;
+    } else if (state.inString) {
+      next = findQuoteOrEscape(block, next);
+      if (next == block.size()) { break; }
+      state.escaped = block[next] == '\\';
+      state.inString = state.escaped;
+      next++;
+    } else {
+      next = findWhiteSpaceOrQuote(block, next);
+      if (next == block.size()) { break; }
+      if (block[next] == '"') {
+        state.inString = true;
+        next++;
+      } else {
+        if (next > run) { destination.add(block.substr(run, next - run)); }
+        next = skipWhiteSpace(block, next);
+        run = next;
+      }
+    }
+  }
+  if (run < block.size()) { destination.add(block.substr(run)); }
+}
+/// <summary>
+/// Check that a source holds a single well-formed JSON value with nothing
+/// but whitespace after it. The source is read by Default_Parser raising
+/// events that only check for duplicate keys, so no tree is built. A contiguous source is
+/// read through a view of its bytes; any other is reset afterwards and
+/// read forward again to the position it was at on entry.
+/// </summary>
+/// <param name="source">Source of JSON.</param>
+void validateSource(ISource &source)
+{
+  Default_Translator translator;
+  Default_Parser parser{ translator };
+  const auto validate = [&](ISource &checked) {
+    DuplicateKeyCheck keyCheck;
+    parser.parseEvents(checked, keyCheck);
+    if (checked.more()) {
+      JSON_THROW(SyntaxError(checked.getPosition(), "Unexpected characters after end of JSON."));
+    }
+  };
+  if (const auto span = source.contiguous(); !span.empty()) {
+    FixedBufferSource view{ span.data(), span.size() };
+    validate(view);
+  } else {
+    const auto start = source.position();
+    validate(source);
+    source.reset();
+    std::array<char, kStripBlockSize> skipped;
+    for (auto position = source.position(); position < start; position = source.position()) {
+      if (source.read(skipped.data(), std::min(start - position, skipped.size())) == 0) { break; }
+    }
+  }
+}
+
+/// <summary>
+/// Strip all whitespace outside of strings from JSON on a source stream,
+/// writing the result to a destination. Unless validate is set the JSON is
+/// assumed to be well-formed.
+/// </summary>
+/// <param name="source">Source of JSON.</param>
+/// <param name="destination">Destination for stripped JSON.</param>
+/// <param name="validate">==true then check the JSON is well-formed first.</param>
+void JSON_Impl::strip(ISource &source, IDestination &destination, const bool validate)
+{
+  if (validate) { validateSource(source); }
+  StringifyBuffer buffer{ destination };
+  StripState state;
+  if (const auto span = source.contiguous(); !span.empty()) {
+    stripBlock(span, state, buffer);
+    source.advance(span.size());
+  } else {
+    std::array<char, kStripBlockSize> block;
+    for (auto length = source.read(block.data(), block.size()); length > 0;
+         length = source.read(block.data(), block.size())) {
+      stripBlock(std::string_view(block.data(), length), state, buffer);
+    }
+  }
+  buffer.flush();
+}
+
+}// namespace JSON_Lib
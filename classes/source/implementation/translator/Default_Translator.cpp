@@ -8,12 +8,20 @@
 // Dependencies: C++20 - Language standard features used.
 //
 
+#include <algorithm>
 #include <array>
+#include <bit>
+#include <utility>
 #include "JSON.hpp"
 #include "JSON_Node_Core.hpp"
 #include "Default_Translator.hpp"
 #include "JSON_Throw.hpp"
 
+#if defined(__x86_64__) || defined(_M_X64)
+#define JSON_LIB_TRANSLATOR_SSE2 1
+#include <emmintrin.h>
+#endif
+
 namespace JSON_Lib {
 
 static constexpr std::array<std::pair<char, char>, 7> escapeSequences{{ {'\\', '\\'},
@@ -24,48 +32,70 @@ static constexpr std::array<std::pair<char, char>, 7> escapeSequences{{ {'\\', '
   {'n', '\n'},
   {'r', '\r'} }};
 
+// Character for each single character escape, indexed by the character after '\' (zero for none)
+static constexpr std::array<char, 128> fromEscape = [] {
+  std::array<char, 128> table{};
+  for (const auto &[key, value] : escapeSequences) { table[static_cast<unsigned char>(key)] = value; }
+  return table;
+}();
+// Single character escape for each ASCII character (zero for none)
+static constexpr std::array<char, 128> toEscape = [] {
+  std::array<char, 128> table{};
+  for (const auto &[key, value] : escapeSequences) { table[static_cast<unsigned char>(value)] = key; }
+  return table;
+}();
+
 /// <summary>
-/// Convert \uxxxx escape sequences in a string to their correct sequence
-///  of UTF-8 characters.
+/// Convert the four hex digits of a \uxxxx escape sequence to the UTF16
+/// character they represent.
 /// </summary>
-/// <param name="current">Current character position.</param>
-/// <param name="numberOfCharacters">Number of characters left in source string.</param>
-/// <returns>UTF16 character for "\uxxxx".</returns>
-char16_t decodeUTF16(std::string_view::const_iterator &current, const ptrdiff_t numberOfCharacters)
+/// <param name="escapedString">JSON string being translated.</param>
+/// <param name="next">Index of the 'u'; moved past the hex digits.</param>
+/// <param name="utf16value">UTF16 character for "\uxxxx".</param>
+/// <returns>False if there are not four hex digits.</returns>
+bool decodeUTF16(const std::string_view &escapedString, std::size_t &next, char16_t &utf16value)
 {
-  if (numberOfCharacters >= 4) {
-    char16_t utf16value{};
-    // Hex digits will be ascii so can throw away high order byte of char
-    const std::array hexDigits{ (current[1]),
-      (current[2]),
-      (current[3]),
-      (current[4]),
-      '\0' };
-    char *end;
-    utf16value += static_cast<char16_t>(std::strtol(hexDigits.data(), &end, 16));
-    if (*end == '\0') {
-      current += hexDigits.size();
-      return utf16value;
+  if (escapedString.size() - next <= 4) { return false; }
+  utf16value = 0;
+  for (const auto ch : escapedString.substr(next + 1, 4)) {
+    utf16value <<= 4;
+    if (ch >= '0' && ch <= '9') {
+      utf16value |= static_cast<char16_t>(ch - '0');
+    } else if (ch >= 'a' && ch <= 'f') {
+      utf16value |= static_cast<char16_t>(ch - 'a' + 10);
+    } else if (ch >= 'A' && ch <= 'F') {
+      utf16value |= static_cast<char16_t>(ch - 'A' + 10);
+    } else {
+      return false;
     }
   }
-  JSON_THROW(Default_Translator::Error("Syntax error detected."));
+  next += 5;
+  return true;
 }
 /// <summary>
 /// Convert UTF16 character into its \uxxxx encoded escape sequence.
 /// </summary>
 /// <param name="utf16Char">UTF16 encode character.</param>
 /// <returns>Escape sequence "\uxxxx" for utf16 character.</returns>
-std::string encodeUTF16(const char16_t utf16Char)
+std::array<char, 6> encodeUTF16(const char16_t utf16Char)
 {
-  std::string utf8Buffer;
   static constexpr std::string_view digits{"0123456789ABCDEF"};
-  static constexpr std::string_view unicodePrefix{"\\u"};
-  utf8Buffer += unicodePrefix;
-  utf8Buffer += digits[utf16Char >> 12 & 0x0f];
-  utf8Buffer += digits[utf16Char >> 8 & 0x0f];
-  utf8Buffer += digits[utf16Char >> 4 & 0x0f];
-  utf8Buffer += digits[utf16Char & 0x0f];
-  return utf8Buffer;
+  return { '\\',
+    'u',
+    digits[utf16Char >> 12 & 0x0f],
+    digits[utf16Char >> 8 & 0x0f],
+    digits[utf16Char >> 4 & 0x0f],
+    digits[utf16Char & 0x0f] };
+}
+/// <summary>
+/// Append the UTF-8 encoding of a Unicode code point to a string.
+/// </summary>
+/// <param name="utf8String">String to append to.</param>
+/// <param name="codePoint">Unicode code point.</param>
+void appendUtf8(std::string &utf8String, const char32_t codePoint)
+{
+  std::array<char, kMaxUtf8Bytes> bytes{};
+  utf8String.append(bytes.data(), encodeUtf8(codePoint, bytes.data()));
 }
 /// <summary>
 /// Return true if a character is a valid upper surrogate.
@@ -88,86 +118,172 @@ bool isValidSurrogateLower(const char16_t utf16Char)
          && utf16Char <= static_cast<char16_t>(kLowSurrogatesEnd);
 }
 /// <summary>
-/// Check that there are no single unpaired UTF-16 surrogates.From what I see
-/// this is meant to be an error, but from searching the web, I have not found a
-/// definitive answer.
+/// Determine whether passed in character is valid ASCII
 /// </summary>
-/// <param name="utf16Buffer">UTF16 string.</param>
-/// <returns>False if string contains an unpaired surrogate.</returns>
-bool unpairedSurrogatesInBuffer(const std::u16string &utf16Buffer)
+/// <param name="utf16Char">UTF16 character.</param>
+/// <returns>True if valid ASCII.</returns>
+bool isASCII(const char16_t utf16Char) { return utf16Char > 0x001F && utf16Char < 0x0080; }
+/// <summary>
+/// Return true if a byte cannot be copied unchanged into a JSON string; that
+/// is a control character, '"', '\', DEL or part of a multi-byte UTF-8
+/// sequence.
+/// </summary>
+/// <param name="ch">Byte of UTF-8 string.</param>
+/// <returns>True if byte needs escaping.</returns>
+bool needsEscape(const unsigned char ch) { return ch < 0x20 || ch == '"' || ch == '\\' || ch >= 0x7F; }
+/// <summary>
+/// Find the next byte in a string that needs escaping, checking sixteen bytes
+/// at a time where SSE2 is available.
+/// </summary>
+/// <param name="rawString">UTF-8 string.</param>
+/// <param name="next">Index to start searching from.</param>
+/// <returns>Index of byte needing escaping or string length if none.</returns>
+std::size_t findEscape(const std::string_view &rawString, std::size_t next)
 {
-  int index = 0;
-  while (index <= static_cast<int>(utf16Buffer.size()) - 1) {
-    if (isValidSurrogateUpper(utf16Buffer[index]) && isValidSurrogateLower(utf16Buffer[index + 1])) {
-      index++;
-    } else if (isValidSurrogateUpper(utf16Buffer[index]) || isValidSurrogateLower(utf16Buffer[index + 1])) {
-      return true;
+#if JSON_LIB_TRANSLATOR_SSE2
+  const __m128i space = _mm_set1_epi8(0x20);
+  const __m128i quote = _mm_set1_epi8('"');
+  const __m128i backslash = _mm_set1_epi8('\\');
+  const __m128i del = _mm_set1_epi8(0x7F);
+  for (; next + 16 <= rawString.size(); next += 16) {
+    const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(rawString.data() + next));
+    // Signed compare so bytes 0x80 and above count as less than space
+    const __m128i escapes = _mm_or_si128(_mm_or_si128(_mm_cmplt_epi8(chunk, space), _mm_cmpeq_epi8(chunk, del)),
+      _mm_or_si128(_mm_cmpeq_epi8(chunk, quote), _mm_cmpeq_epi8(chunk, backslash)));
+    if (const int mask = _mm_movemask_epi8(escapes); mask != 0) {
+      return next + static_cast<std::size_t>(std::countr_zero(static_cast<unsigned>(mask)));
     }
-    index++;
   }
-  return false;
+#endif
+  while (next < rawString.size() && !needsEscape(static_cast<unsigned char>(rawString[next]))) { next++; }
+  return next;
 }
 /// <summary>
-/// Determine whether passed in character is valid ASCII
+/// Escape a raw UTF-8 string for its JSON form. Runs of characters that need
+/// no escaping are passed to append unchanged, as is each escape sequence.
+/// Characters outside the BMP are escaped as a UTF-16 surrogate pair.
 /// </summary>
-/// <param name="utf16Char">UTF16 character.</param>
-/// <returns>True if valid ASCII.</returns>
-bool isASCII(const char16_t utf16Char) { return utf16Char > 0x001F && utf16Char < 0x0080; }
+/// <param name="rawString">String to convert.</param>
+/// <param name="append">Function called with each piece of escaped string.</param>
+template<typename Append> void escapeString(const std::string_view &rawString, Append append)
+{
+  std::size_t start = 0;
+  for (auto next = findEscape(rawString, 0); next < rawString.size(); next = findEscape(rawString, start)) {
+    if (next > start) { append(rawString.substr(start, next - start)); }
+    if (const auto ch = static_cast<unsigned char>(rawString[next]); ch < 0x80) {
+      if (ch == 0) { JSON_THROW(Error("Tried to convert a null character.")); }
+      if (toEscape[ch] != 0) {
+        const std::array sequence{ '\\', toEscape[ch] };
+        append(std::string_view(sequence.data(), sequence.size()));
+      } else {
+        const auto sequence = encodeUTF16(ch);
+        append(std::string_view(sequence.data(), sequence.size()));
+      }
+      start = next + 1;
+    } else {
+      const auto [codePoint, length] = decodeUtf8(rawString, next);
+      if (length == 0) { JSON_THROW(Default_Translator::Error("Invalid UTF-8 character sequence.")); }
+      if (codePoint > 0xFFFF) {
+        const auto high = encodeUTF16(static_cast<char16_t>(kHighSurrogatesBegin + ((codePoint - 0x10000) >> 10)));
+        const auto low = encodeUTF16(static_cast<char16_t>(kLowSurrogatesBegin + ((codePoint - 0x10000) & 0x3FF)));
+        append(std::string_view(high.data(), high.size()));
+        append(std::string_view(low.data(), low.size()));
+      } else {
+        const auto sequence = encodeUTF16(static_cast<char16_t>(codePoint));
+        append(std::string_view(sequence.data(), sequence.size()));
+      }
+      start = next + length;
+    }
+  }
+  if (start < rawString.size()) { append(rawString.substr(start)); }
+}
 /// <summary>
 /// JSON translator constructor.
 /// </summary>
-Default_Translator::Default_Translator()
+Default_Translator::Default_Translator() = default;
+/// <summary>
+/// Convert any escape sequences in a string to their correct sequence
+///  of UTF-8 characters, throwing the error tryFrom() reports if any are
+///  malformed.
+/// </summary>
+/// <param name="escapedString">JSON string to process.</param>
+/// <returns>String with escapes translated.</returns>
+std::string Default_Translator::from(const std::string_view &escapedString) const
 {
-  // Initialise tables used to convert to/from single character
-  // escape sequences within a JSON string.
-  for (const auto &[key, value] : escapeSequences) {
-    fromEscape[key] = value;
-    toEscape[value] = key;
+  std::string unescaped;
+  if (const char *message = nullptr; !tryFrom(escapedString, unescaped, message)) {
+    if (message == kNullCharacter) { JSON_THROW(JSON_Lib::Error(message)); }
+    JSON_THROW(Error(message));
   }
+  return unescaped;
 }
 /// <summary>
 /// Convert any escape sequences in a string to their correct sequence
-///  of UTF-8 characters.If input string contains any unpaired surrogates,
-///  then this is deemed as a syntax error, and an error is duly thrown.
+///  of UTF-8 characters in a single pass, copying the text between escapes
+///  unchanged. A \uxxxx high surrogate must be followed directly by an
+///  escaped low surrogate; any unpaired surrogate is deemed a syntax error,
+///  which is reported rather than thrown.
 /// </summary>
 /// <param name="escapedString">JSON string to process.</param>
-/// <returns>String with escapes translated.</returns>
-std::string Default_Translator::from(const std::string_view &escapedString) const
+/// <param name="unescaped">String with escapes translated.</param>
+/// <param name="message">Error message if an escape is malformed.</param>
+/// <returns>False if an escape is malformed.</returns>
+bool Default_Translator::tryFrom(const std::string_view &escapedString, std::string &unescaped, const char *&message) const
 {
-  std::u16string utf16Buffer;
-  for (auto current = escapedString.begin(); current != escapedString.end();) {
-    // Normal character
-    if (*current != '\\') {
-      utf16Buffer += *current++;
-      continue;
-    }
-    ++current;
+  const auto fail = [&message](const std::string_view &error) {
+    message = error.data();
+    return false;
+  };
+  unescaped.clear();
+  unescaped.reserve(escapedString.size());
+  std::size_t next = 0;
+  while (true) {
+    // Copy everything up to the next escape in one go
+    const auto escape = static_cast<std::size_t>(
+      std::find_if(escapedString.begin() + static_cast<std::ptrdiff_t>(next),
+        escapedString.end(),
+        [](const char ch) { return ch == '\\' || ch == '\0'; })
+      - escapedString.begin());
+    unescaped.append(escapedString.substr(next, escape - next));
+    if (escape == escapedString.size()) { return true; }
+    if (escapedString[escape] == '\0') { return fail(kNullCharacter); }
+    next = escape + 1;
     // Check an escape sequence if characters to process
-    if (current != escapedString.end()) {
-      // Single character
-      if (fromEscape.contains(*current)) {
-        utf16Buffer += fromEscape.at(static_cast<char>(*current));
-        ++current;
-      }
-      // UTF16 "\uxxxx"
-      else if (*current == 'u') {
-        utf16Buffer += decodeUTF16(current, std::distance(current, escapedString.end()));
-      }
-      // Escaped ASCII
-      else if (isASCII(*current)) {
-        utf16Buffer += *current;
-        ++current;
-      }
-      // Invalid escaped character
-      else {
-        JSON_THROW(Error("Invalid escaped character."));
+    if (next == escapedString.size()) { return fail("Premature and of character escape sequence."); }
+    const auto ch = static_cast<unsigned char>(escapedString[next]);
+    // Single character
+    if (ch < fromEscape.size() && fromEscape[ch] != 0) {
+      unescaped += fromEscape[ch];
+      next++;
+    }
+    // UTF16 "\uxxxx" (a surrogate pair is two of them)
+    else if (ch == 'u') {
+      char16_t utf16Char{};
+      if (!decodeUTF16(escapedString, next, utf16Char)) { return fail("Syntax error detected."); }
+      if (isValidSurrogateUpper(utf16Char)) {
+        if (escapedString.substr(next, 2) != "\\u") { return fail("Unpaired surrogate found."); }
+        next++;
+        char16_t lowerChar{};
+        if (!decodeUTF16(escapedString, next, lowerChar)) { return fail("Syntax error detected."); }
+        if (!isValidSurrogateLower(lowerChar)) { return fail("Unpaired surrogate found."); }
+        appendUtf8(unescaped, 0x10000 + ((utf16Char - kHighSurrogatesBegin) << 10) + (lowerChar - kLowSurrogatesBegin));
+      } else if (isValidSurrogateLower(utf16Char)) {
+        return fail("Unpaired surrogate found.");
+      } else {
+        if (utf16Char == 0) { return fail(kNullCharacter); }
+        appendUtf8(unescaped, utf16Char);
       }
-    } else {
-      JSON_THROW(Error("Premature and of character escape sequence."));
+    }
+    // Escaped ASCII
+    else if (isASCII(ch)) {
+      unescaped += static_cast<char>(ch);
+      next++;
+    }
+    // Invalid escaped character
+    else {
+      return fail("Invalid escaped character.");
     }
   }
-  if (unpairedSurrogatesInBuffer(utf16Buffer)) { JSON_THROW(Error("Unpaired surrogate found.")); }
-  return toUtf8(utf16Buffer);
 }
 /// <summary>
 /// Convert a string from raw character values (UTF8) so that it has character
@@ -178,21 +294,19 @@ std::string Default_Translator::from(const std::string_view &escapedString) cons
 std::string Default_Translator::to(const std::string_view &rawString) const
 {
   std::string escapedString;
-  for (char16_t utf16Char : toUtf16(rawString)) {
-    // Control characters
-    if (toEscape.contains(utf16Char)) {
-      escapedString += '\\';
-      escapedString += toEscape.at(utf16Char);
-    }
-    // ASCII
-    else if (isASCII(utf16Char) && std::isprint(utf16Char)) {
-      escapedString += static_cast<char>(utf16Char);
-    }
-    // UTF8 escaped
-    else {
-      escapedString += encodeUTF16(utf16Char);
-    }
-  }
+  escapedString.reserve(rawString.size());
+  escapeString(rawString, [&escapedString](const std::string_view &text) { escapedString += text; });
   return escapedString;
 }
+/// <summary>
+/// Add a string from raw character values (UTF8) to a destination with
+/// character escapes where applicable for its JSON form. Runs of characters
+/// that need no escaping are added as they are.
+/// </summary>
+/// <param name="rawString">String to convert.</param>
+/// <param name="destination">Destination for JSON string with escapes.</param>
+void Default_Translator::addTo(const std::string_view &rawString, IDestination &destination) const
+{
+  escapeString(rawString, [&destination](const std::string_view &text) { destination.add(text); });
+}
 }// namespace JSON_Lib
@@ -3,17 +3,48 @@
 
 namespace JSON_Lib {
 
+/// <summary>
+/// Raise the parse events for an already built Node tree.
+/// </summary>
+/// <param name="jNode">Node tree.</param>
+/// <param name="events">Callbacks to raise.</param>
+static void raiseEvents(const Node &jNode, IEvents &events)
+{
+  jNode.visit(overloaded{
+    [&](const Number &number) { events.onNumber(number); },
+    [&](const String &string) { events.onString(string.value()); },
+    [&](const Boolean &boolean) { events.onBoolean(boolean.value()); },
+    [&](const Null &) { events.onNull(); },
+    [&](const Object &object) {
+      events.onObjectStart();
+      for (const auto &entry : object.value()) {
+        events.onKey(entry.getKey());
+        raiseEvents(entry.getNode(), events);
+      }
+      events.onObjectEnd();
+    },
+    [&](const Array &array) {
+      events.onArrayStart();
+      for (const auto &element : array.value()) { raiseEvents(element, events); }
+      events.onArrayEnd();
+    },
+    [&](const Hole &) {},
+    [&](const std::monostate &) {} });
+}
+
 Result<Node> IParser::parseResult(ISource &source)
 {
   try {
-    return {Status::Ok, std::make_unique<Node>(parse(source)), {}, {0, 0}};
+    return {Status::Ok, parse(source), {}, {0, 0}};
   } catch (const SyntaxError &ex) {
-    return {Status::SyntaxError, nullptr, ex.what(), source.getPosition()};
+    return {Status::SyntaxError, std::nullopt, ex.what(), source.getPosition()};
   } catch (const std::exception &ex) {
-    return {Status::UnknownError, nullptr, ex.what(), source.getPosition()};
+    return {Status::UnknownError, std::nullopt, ex.what(), source.getPosition()};
   } catch (...) {
-    return {Status::UnknownError, nullptr, "Unknown exception during parse.", source.getPosition()};
+    return {Status::UnknownError, std::nullopt, "Unknown exception during parse.", source.getPosition()};
   }
 }
 
+void IParser::parseEvents(ISource &source, IEvents &events) { raiseEvents(parse(source), events); }
+
 } // namespace JSON_Lib
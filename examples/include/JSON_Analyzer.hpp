@@ -121,7 +121,6 @@ public:
     os << "JSON_Lib::Object size " << sizeof(JSON_Lib::Object) << " in bytes.\n";
     os << "JSON_Lib::Object Entry size " << sizeof(JSON_Lib::Object::Entry) << " in bytes.\n";
     os << "JSON_Lib::Array size " << sizeof(JSON_Lib::Array) << " in bytes.\n";
-    os << "JSON_Lib::Number::Values size " << sizeof(JSON_Lib::Number::Values) << " in bytes.\n";
     os << "JSON_Lib::Number size " << sizeof(JSON_Lib::Number) << " in bytes.\n";
     os << "JSON_Lib::String size " << sizeof(JSON_Lib::String) << " in bytes.\n";
     os << "JSON_Lib::Boolean size " << sizeof(JSON_Lib::Boolean) << " in bytes.\n";
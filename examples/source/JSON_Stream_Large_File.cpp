@@ -1,6 +1,8 @@
 // Program: JSON_Stream_Large_File.cpp
 //
 // Description: Demonstrate streaming a large JSON file for memory efficiency.
+// The file is read through a FileSource with parse events rather than being
+// parsed into a Node tree, so memory use depends only on how deeply it nests.
 //
 // Dependencies: C++20, PLOG, JSON_Lib.
 //
@@ -9,6 +11,23 @@
 
 namespace js = JSON_Lib;
 
+// Tally the values in a document as the parser reads them
+class ValueCounter final : public js::IEvents
+{
+public:
+  void onObjectStart() override { objects++; }
+  void onArrayStart() override { arrays++; }
+  void onKey(const std::string_view &) override { keys++; }
+  void onString(const std::string_view &) override { scalars++; }
+  void onNumber(const js::Number &) override { scalars++; }
+  void onBoolean(bool) override { scalars++; }
+  void onNull() override { scalars++; }
+  std::size_t objects{};
+  std::size_t arrays{};
+  std::size_t keys{};
+  std::size_t scalars{};
+};
+
 int main(int, char **)
 {
   try {
@@ -16,10 +35,11 @@ int main(int, char **)
     PLOG_INFO << "JSON_Stream_Large_File started ...";
     PLOG_INFO << js::JSON().version();
     std::string largeFile = "files/large.json";
-    // TODO: Replace with actual streaming logic if supported by JSON_Lib
     js::JSON json;
-    json.parse(js::FileSource{ largeFile });
-    PLOG_INFO << "Parsed large file (streaming logic not implemented).";
+    ValueCounter counter;
+    json.parse(js::FileSource{ largeFile }, counter);
+    PLOG_INFO << "Streamed " << counter.objects << " objects, " << counter.arrays << " arrays, " << counter.keys
+              << " keys and " << counter.scalars << " scalar values.";
     return 0;
   } catch (const std::exception &ex) {
     PLOG_ERROR << "Error: " << ex.what();
@@ -17,6 +17,7 @@ void checkObject(const JSON_Lib::Node &jNode);
 void checkArray(const JSON_Lib::Node &jNode);
 std::string generateRandomFileName(void);
 std::string generateEscapes(unsigned char first, unsigned char last);
+std::string nodeText(const JSON_Lib::Node &jNode);
 // Test files macro
 #define TEST_FILE_LIST(file)                                     \
   auto file = GENERATE(values<std::string>({ "testfile001.json", \
@@ -44,6 +45,34 @@ template<typename T> bool equalFloatingPoint(T a, T b, double epsilon) { return
 
 using namespace JSON_Lib;
 
+// Text of each result collect() adds to a list, or just the error reported if it throws
+template<typename Collect> std::vector<std::string> textOrError(Collect collect)
+{
+  std::vector<std::string> results;
+  try {
+    collect(results);
+  } catch (const std::exception &ex) {
+    return { ex.what() };
+  }
+  return results;
+}
+
+// Record each parse event as text (eg. "{", "key:x", "n:1", "s:a", "]") to compare sequences
+class EventRecorder final : public IEvents
+{
+public:
+  void onObjectStart() override { events.emplace_back("{"); }
+  void onObjectEnd() override { events.emplace_back("}"); }
+  void onArrayStart() override { events.emplace_back("["); }
+  void onArrayEnd() override { events.emplace_back("]"); }
+  void onKey(const std::string_view &key) override { events.push_back("key:" + std::string(key)); }
+  void onString(const std::string_view &value) override { events.push_back("s:" + std::string(value)); }
+  void onNumber(const Number &value) override { events.push_back("n:" + value.toString()); }
+  void onBoolean(const bool value) override { events.emplace_back(value ? "true" : "false"); }
+  void onNull() override { events.emplace_back("null"); }
+  std::vector<std::string> events;
+};
+
 struct ScopedMaxDepth final
 {
   JSON &json;
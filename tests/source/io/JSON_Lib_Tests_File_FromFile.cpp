@@ -1,5 +1,35 @@
 #include "JSON_Lib_Tests.hpp"
 
+#if !defined(_WIN32)
+#include <sys/stat.h>
+#include <thread>
+#endif
+
+// Write code points to a file as UTF-16 or UTF-32 with a byte order mark. Code
+// points outside the BMP are written to UTF-16 as a surrogate pair; anything
+// else (including surrogates and out of range values) is written as given.
+static void writeEncodedFile(const std::string &fileName, const std::u32string &text, const JSON::Format format)
+{
+  const bool utf32 = format == JSON::Format::utf32BE || format == JSON::Format::utf32LE;
+  const bool bigEndian = format == JSON::Format::utf16BE || format == JSON::Format::utf32BE;
+  std::ofstream out{ fileName, std::ios::binary };
+  const auto writeUnit = [&](const char32_t unit) {
+    const int size = utf32 ? 4 : 2;
+    for (int index = 0; index < size; index++) {
+      out.put(static_cast<char>(unit >> (8 * (bigEndian ? size - 1 - index : index))));
+    }
+  };
+  writeUnit(0xFEFF);
+  for (const char32_t codePoint : text) {
+    if (!utf32 && codePoint > 0xFFFF && codePoint <= 0x10FFFF) {
+      writeUnit(0xD800 + ((codePoint - 0x10000) >> 10));
+      writeUnit(0xDC00 + ((codePoint - 0x10000) & 0x3FF));
+    } else {
+      writeUnit(codePoint);
+    }
+  }
+}
+
 TEST_CASE("Checks for fromFile() api.", "[JSON][FromFile]")
 {
   SECTION("Check that fromFile() works with UTF8.", "[JSON][FromFile][UTF8]")
@@ -30,15 +60,13 @@ TEST_CASE("Checks for fromFile() api.", "[JSON][FromFile]")
   {
     std::string testFile{ prefixTestDataPath("testfile025.json") };
     std::string expected{ R"([true  , "Out of time",  7.89043e+18, true])" };
-    REQUIRE_THROWS_WITH(
-      JSON::fromFile(testFile), "JSON Error: Unsupported JSON file format (Byte Order Mark) encountered.");
+    REQUIRE(JSON::fromFile(testFile) == expected);
   }
   SECTION("Check that fromFile() works with UTF32LE.", "[JSON][FromFile][UTF32LE]")
   {
     std::string testFile{ prefixTestDataPath("testfile026.json") };
     std::string expected{ R"([true  , "Out of time",  7.89043e+18, true])" };
-    REQUIRE_THROWS_WITH(
-      JSON::fromFile(testFile), "JSON Error: Unsupported JSON file format (Byte Order Mark) encountered.");
+    REQUIRE(JSON::fromFile(testFile) == expected);
   }
   SECTION("Check that fromFile() works with UTF16LE and leading spaces.", "[JSON][FromFile][UTF16LE][Whitespace]")
   {
@@ -46,6 +74,61 @@ TEST_CASE("Checks for fromFile() api.", "[JSON][FromFile]")
     std::string expected{ R"(   [true  , "Out of time",  7.89043e+18, true])" };
     REQUIRE(JSON::fromFile(testFile) == expected);
   }
+  SECTION("Check that fromFile() transcodes non-ASCII UTF16/UTF32 to UTF8.", "[JSON][FromFile][UTF16][UTF32]")
+  {
+    std::string testFile{ generateRandomFileName() };
+    const std::u32string text{ U"[\"caf\u00E9\", \"\u20AC\u0100\", \"\U0001D11E\"]" };
+    const std::string expected{ "[\"caf\xC3\xA9\", \"\xE2\x82\xAC\xC4\x80\", \"\xF0\x9D\x84\x9E\"]" };
+    for (const auto format :
+      { JSON::Format::utf16BE, JSON::Format::utf16LE, JSON::Format::utf32BE, JSON::Format::utf32LE }) {
+      writeEncodedFile(testFile, text, format);
+      REQUIRE(JSON::getFileFormat(testFile) == format);
+      REQUIRE(JSON::fromFile(testFile) == expected);
+    }
+    std::filesystem::remove(testFile);
+  }
+  SECTION("Check that fromFile() transcodes UTF16 larger than a block with surrogate pairs split across blocks.",
+    "[JSON][FromFile][UTF16]")
+  {
+    std::string testFile{ generateRandomFileName() };
+    std::u32string text{ U"\"" };
+    std::string expected{ "\"" };
+    for (int index = 0; index < 5000; index++) {
+      text += U"a\U0001F600";
+      expected += "a\xF0\x9F\x98\x80";
+    }
+    text += U"\"";
+    expected += "\"";
+    for (const auto format : { JSON::Format::utf16BE, JSON::Format::utf16LE }) {
+      writeEncodedFile(testFile, text, format);
+      REQUIRE(JSON::fromFile(testFile) == expected);
+      writeEncodedFile(testFile, U" " + text, format);
+      REQUIRE(JSON::fromFile(testFile) == " " + expected);
+    }
+    std::filesystem::remove(testFile);
+  }
+  SECTION("Check that fromFile() throws on malformed UTF16/UTF32.", "[JSON][FromFile][UTF16][UTF32]")
+  {
+    std::string testFile{ generateRandomFileName() };
+    for (const auto format :
+      { JSON::Format::utf16BE, JSON::Format::utf16LE, JSON::Format::utf32BE, JSON::Format::utf32LE }) {
+      writeEncodedFile(testFile, std::u32string{ U'[', U'1', 0, U']' }, format);
+      REQUIRE_THROWS_WITH(JSON::fromFile(testFile), "JSON Error: Tried to convert a null character.");
+    }
+    for (const auto format : { JSON::Format::utf16BE, JSON::Format::utf16LE }) {
+      writeEncodedFile(testFile, U"[\"" + std::u32string{ 0xDC00 } + U"\"]", format);
+      REQUIRE_THROWS_WITH(JSON::fromFile(testFile), "JSON Error: Invalid UTF-16 character sequence.");
+      writeEncodedFile(testFile, U"[\"" + std::u32string{ 0xD800 }, format);
+      REQUIRE_THROWS_WITH(JSON::fromFile(testFile), "JSON Error: Invalid UTF-16 character sequence.");
+    }
+    for (const auto format : { JSON::Format::utf32BE, JSON::Format::utf32LE }) {
+      writeEncodedFile(testFile, U"[\"" + std::u32string{ 0xD800 } + U"\"]", format);
+      REQUIRE_THROWS_WITH(JSON::fromFile(testFile), "JSON Error: Invalid UTF-32 character sequence.");
+      writeEncodedFile(testFile, U"[\"" + std::u32string{ 0x110000 } + U"\"]", format);
+      REQUIRE_THROWS_WITH(JSON::fromFile(testFile), "JSON Error: Invalid UTF-32 character sequence.");
+    }
+    std::filesystem::remove(testFile);
+  }
   SECTION("Check that fromFile() preserves leading whitespace for UTF8.", "[JSON][FromFile][UTF8][Whitespace]")
   {
     std::string testFile{ generateRandomFileName() };
@@ -66,6 +149,16 @@ TEST_CASE("Checks for fromFile() api.", "[JSON][FromFile]")
     REQUIRE(JSON::fromFile(testFile) == withLF);
     std::filesystem::remove(testFile);
   }
+  SECTION("Check that fromFile() translates runs of CRLF and leaves lone CRs.", "[JSON][FromFile][CRLF]")
+  {
+    std::string testFile{ generateRandomFileName() };
+    {
+      std::ofstream out{ testFile, std::ios::binary };
+      out << "\r\n[1,\r\r\n\r\n2,\r3]\r\n";
+    }
+    REQUIRE(JSON::fromFile(testFile) == "\n[1,\r\n\n2,\r3]\n");
+    std::filesystem::remove(testFile);
+  }
   SECTION("Check that fromFile() result can be successfully parsed.", "[JSON][FromFile][Parse]")
   {
     JSON json;
@@ -76,4 +169,37 @@ TEST_CASE("Checks for fromFile() api.", "[JSON][FromFile]")
   {
     REQUIRE(JSON::fromFile(prefixTestDataPath(kNonExistantJSONFile)).empty());
   }
+#if !defined(_WIN32)
+  SECTION("Check that fromFile() reads a FIFO that reports no file size.", "[JSON][FromFile][FIFO]")
+  {
+    std::string testFile{ generateRandomFileName() };
+    REQUIRE(mkfifo(testFile.c_str(), 0600) == 0);
+    std::string expected{ "[" };
+    for (int index = 0; index < 20000; index++) { expected += std::to_string(index) + ",\"Out of time\","; }
+    expected += "true]";
+    std::thread writer{ [&] {
+      std::ofstream out{ testFile, std::ios::binary };
+      out << "\xEF\xBB\xBF" << expected;
+    } };
+    const std::string read{ JSON::fromFile(testFile) };
+    writer.join();
+    REQUIRE(read == expected);
+    std::filesystem::remove(testFile);
+  }
+  SECTION("Check that MappedFileSource reads a FIFO that reports no file size.", "[JSON][MappedFile][FIFO]")
+  {
+    std::string testFile{ generateRandomFileName() };
+    REQUIRE(mkfifo(testFile.c_str(), 0600) == 0);
+    std::thread writer{ [&] {
+      std::ofstream out{ testFile, std::ios::binary };
+      out << "[1,2]";
+    } };
+    JSON json;
+    json.parse(MappedFileSource{ testFile });
+    writer.join();
+    REQUIRE(NRef<Array>(json.root()).size() == 2);
+    REQUIRE(NRef<Number>(json[1]).value<int>() == 2);
+    std::filesystem::remove(testFile);
+  }
+#endif
 }
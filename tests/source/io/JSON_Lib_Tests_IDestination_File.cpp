@@ -151,4 +151,61 @@ TEST_CASE("Check IDestination (File) interface.", "[JSON][IDestination][File]")
     REQUIRE(result == buffer.toString());
     std::filesystem::remove(fileName);
   }
+  SECTION("Create FileDestination without line ending translation.", "[JSON][IDestination][File][Linefeed]")
+  {
+    const std::string fileName{ generateRandomFileName() };
+    FileDestination file{ fileName, FileDestination::LineEnding::lf };
+    file.add("65767\n");
+    file.add('\n');
+    file.add(std::string_view{ "22222\r\n" });
+    REQUIRE(file.size() == 14);
+    file.close();
+    std::ifstream written{ fileName, std::ios_base::binary };
+    REQUIRE(std::string(std::istreambuf_iterator<char>(written), {}) == "65767\n\n22222\r\n");
+    written.close();
+    std::filesystem::remove(fileName);
+  }
+  SECTION("Output is held in the block until it fills or is flushed.", "[JSON][IDestination][File][Flush]")
+  {
+    const std::string fileName{ generateRandomFileName() };
+    FileDestination file{ fileName, FileDestination::LineEnding::crlf, 8 };
+    file.add("abc\n");
+    REQUIRE(std::filesystem::file_size(fileName) == 0);
+    file.add("defg");
+    REQUIRE(std::filesystem::file_size(fileName) == 5);
+    file.flush();
+    REQUIRE(std::filesystem::file_size(fileName) == 9);
+    REQUIRE(file.size() == 9);
+    file.close();
+    std::filesystem::remove(fileName);
+  }
+  SECTION("Output of any size is written whole whatever the block size.", "[JSON][IDestination][File][Block]")
+  {
+    std::string expected;
+    for (int line = 0; line < 1000; line++) { expected += "line " + std::to_string(line) + "\n"; }
+    for (const std::size_t blockSize : { 0, 1, 7, 64, 100000 }) {
+      const std::string fileName{ generateRandomFileName() };
+      {
+        FileDestination file{ fileName, FileDestination::LineEnding::crlf, blockSize };
+        file.add(expected.substr(0, 1000));
+        for (const auto ch : expected.substr(1000, 1000)) { file.add(ch); }
+        file.add(expected.substr(2000));
+        REQUIRE(file.last() == '\n');
+      }
+      REQUIRE(std::filesystem::file_size(fileName) == expected.size() + 1000);
+      REQUIRE(JSON::fromFile(fileName) == expected);
+      std::filesystem::remove(fileName);
+    }
+  }
+  SECTION("Clear discards output still held in the block.", "[JSON][IDestination][File][Clear]")
+  {
+    const std::string fileName{ generateRandomFileName() };
+    FileDestination file{ fileName };
+    file.add("discarded");
+    file.clear();
+    file.add("kept");
+    file.close();
+    REQUIRE(JSON::fromFile(fileName) == "kept");
+    std::filesystem::remove(fileName);
+  }
 }
@@ -175,6 +175,34 @@ TEST_CASE("Check ISource (Buffer) interface.", "[JSON][ISource][Buffer]")
     REQUIRE(source.position() == 5);
     REQUIRE(source.current() == ',');
   }
+  SECTION("Check that BufferSource contiguous() returns the unread remainder of the buffer.",
+    "[JSON][ISource][Buffer][Contiguous]")
+  {
+    BufferSource source{ R"([true,"key"])" };
+    REQUIRE(source.contiguous() == R"([true,"key"])");
+    source.next();
+    REQUIRE(source.contiguous() == R"(true,"key"])");
+    while (source.more()) { source.next(); }
+    REQUIRE(source.contiguous().empty());
+  }
+  SECTION("Check that BufferSource advance() tracks position, line and column the same as next().",
+    "[JSON][ISource][Buffer][Contiguous]")
+  {
+    const std::string text{ "[1,\n2,\n\n  3]" };
+    for (std::size_t length = 0; length <= text.size(); length++) {
+      BufferSource stepped{ text };
+      BufferSource advanced{ text };
+      for (std::size_t step = 0; step < length; step++) { stepped.next(); }
+      advanced.advance(length);
+      REQUIRE(advanced.position() == stepped.position());
+      REQUIRE(advanced.getPosition() == stepped.getPosition());
+    }
+  }
+  SECTION("Check that BufferSource advance() past the end of the buffer throws.", "[JSON][ISource][Buffer][Exception]")
+  {
+    BufferSource source{ "[1]" };
+    REQUIRE_THROWS_WITH(source.advance(4), "ISource Error: Tried to read past and of buffer.");
+  }
   SECTION("Create BufferSource with a single character.", "[JSON][ISource][Buffer][Construct]")
   {
     BufferSource source{ "x" };
@@ -172,6 +172,36 @@ TEST_CASE("Check ISource (File) interface.", "[JSON][ISource][File]")
     source.close();
     std::filesystem::remove(testFileName);
   }
+  SECTION("Create a FileSource and check read() returns the same characters and positions as next().",
+    "[JSON][ISource][File][Read]")
+  {
+    const std::string testFileName{ generateRandomFileName() };
+    {
+      std::ofstream out{ testFileName, std::ios::binary };
+      out << "[true\r\n,\"Out\r\r\nof\rtime\"\r\n\r\n,7.89043e+18\n,true]\r\n";
+    }
+    FileSource stepped{ testFileName };
+    std::string expected;
+    std::vector<std::pair<long, long>> positions{ stepped.getPosition() };
+    while (stepped.more()) {
+      expected.push_back(stepped.current());
+      stepped.next();
+      positions.push_back(stepped.getPosition());
+    }
+    for (std::size_t blockSize = 1; blockSize <= 8; blockSize++) {
+      FileSource source{ testFileName };
+      std::string result;
+      std::string block(blockSize, ' ');
+      for (auto length = source.read(block.data(), blockSize); length > 0;
+           length = source.read(block.data(), blockSize)) {
+        result.append(block, 0, length);
+        REQUIRE(source.getPosition() == positions[result.size()]);
+      }
+      REQUIRE(result == expected);
+      REQUIRE_FALSE(source.more());
+    }
+    std::filesystem::remove(testFileName);
+  }
   SECTION("Create FileSource, move to end, reset and verify current() returns first character.",
     "[JSON][ISource][File][Reset]")
   {
@@ -0,0 +1,87 @@
+#include "JSON_Lib_Tests.hpp"
+
+TEST_CASE("Check ISource (MappedFile) interface.", "[JSON][ISource][MappedFile]")
+{
+  SECTION("Create MappedFileSource with testfile001.json.", "[JSON][ISource][MappedFile][Construct]")
+  {
+    const std::string testFileName{ prefixTestDataPath(kSingleJSONFile) };
+    REQUIRE_NOTHROW(MappedFileSource(testFileName));
+  }
+  SECTION("Create MappedFileSource with non existent file.", "[JSON][ISource][MappedFile][Exception]")
+  {
+    const std::string nonExistentFileName{ prefixTestDataPath(kNonExistantJSONFile) };
+    REQUIRE_THROWS_WITH(
+      MappedFileSource(nonExistentFileName), "ISource Error: File input stream failed to open or does not exist.");
+  }
+  SECTION("Whole file is presented as one contiguous span.", "[JSON][ISource][MappedFile][Contiguous]")
+  {
+    const std::string testFileName{ prefixTestDataPath(kSingleJSONFile) };
+    MappedFileSource source{ testFileName };
+    REQUIRE(source.contiguous().size() == std::filesystem::file_size(testFileName));
+    REQUIRE(source.current() == '{');
+    source.next();
+    REQUIRE(source.position() == 1);
+    REQUIRE(source.contiguous().size() == std::filesystem::file_size(testFileName) - 1);
+  }
+  SECTION("Reading past the end of the file throws; reset returns to the start.", "[JSON][ISource][MappedFile][Reset]")
+  {
+    const std::string testFileName{ prefixTestDataPath(kSingleJSONFile) };
+    MappedFileSource source{ testFileName };
+    while (source.more()) { source.next(); }
+    REQUIRE(source.position() == std::filesystem::file_size(testFileName));
+    REQUIRE(source.current() == static_cast<char>(EOF));
+    REQUIRE_THROWS_WITH(source.next(), "ISource Error: Tried to read past end of file.");
+    source.reset();
+    REQUIRE(source.position() == 0);
+    REQUIRE(source.current() == '{');
+  }
+  SECTION("An empty file is read as an empty source.", "[JSON][ISource][MappedFile][Empty]")
+  {
+    const std::string testFileName{ generateRandomFileName() };
+    JSON::toFile(testFileName, "");
+    {
+      MappedFileSource source{ testFileName };
+      REQUIRE_FALSE(source.more());
+      REQUIRE(source.contiguous().empty());
+    }
+    std::filesystem::remove(testFileName);
+  }
+  SECTION("Each example file parses as it does through FileSource.", "[JSON][ISource][MappedFile][Parse]")
+  {
+    TEST_FILE_LIST(testFile);
+    JSON expected;
+    expected.parse(FileSource{ prefixTestDataPath(testFile) });
+    JSON json;
+    MappedFileSource source{ prefixTestDataPath(testFile) };
+    json.parse(source);
+    REQUIRE_FALSE(source.more());
+    REQUIRE(json.stringifyToString() == expected.stringifyToString());
+  }
+  SECTION("Errors report the same position as FileSource, CRLF line ends included.",
+    "[JSON][ISource][MappedFile][Exception]")
+  {
+    const std::string testFileName{ generateRandomFileName() };
+    JSON::toFile(testFileName, "{\r\n  \"a\" : [1, 2],\r\n  \"b\" 3\r\n}");
+    std::string expected;
+    try {
+      JSON().parse(FileSource{ testFileName });
+    } catch (const std::exception &ex) {
+      expected = ex.what();
+    }
+    REQUIRE(expected == "JSON Syntax Error [Line: 3 Column: 8]: Missing ':' in key value pair.");
+    REQUIRE_THROWS_WITH(JSON().parse(MappedFileSource{ testFileName }), expected);
+    std::filesystem::remove(testFileName);
+  }
+  SECTION("Borrowed strings keep the mapping alive after the source has gone.", "[JSON][ISource][MappedFile][Borrowed]")
+  {
+    const std::string testFileName{ generateRandomFileName() };
+    JSON::toFile(testFileName, R"({"key":"value","list":["one","two"]})");
+    JSON json;
+    json.setBorrowedStrings(true);
+    json.parse(MappedFileSource{ testFileName });
+    REQUIRE(NRef<String>(json["key"]).isBorrowed());
+    REQUIRE(NRef<String>(json["key"]).value() == "value");
+    REQUIRE(NRef<String>(json["list"][1]).value() == "two");
+    std::filesystem::remove(testFileName);
+  }
+}
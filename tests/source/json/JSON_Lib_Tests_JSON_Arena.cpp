@@ -0,0 +1,79 @@
+#include "JSON_Lib_Tests.hpp"
+
+TEST_CASE("Check JSON arena mode.", "[JSON][Arena]")
+{
+  JSON json;
+  SECTION("Arena mode is off by default and can be toggled.", "[JSON][Arena]")
+  {
+    REQUIRE_FALSE(json.getArenaMode());
+    json.setArenaMode(true);
+    REQUIRE(json.getArenaMode());
+    json.setArenaMode(false);
+    REQUIRE_FALSE(json.getArenaMode());
+  }
+  SECTION("Parsed tree is allocated from the arena only in arena mode.", "[JSON][Arena]")
+  {
+    json.parse(BufferSource{ R"({"a":[1,2,3]})" });
+    REQUIRE(NRef<Object>(json.root()).resource() == std::pmr::get_default_resource());
+    json.setArenaMode(true);
+    json.parse(BufferSource{ R"({"a":[1,2,3]})" });
+    REQUIRE(NRef<Object>(json.root()).resource() != std::pmr::get_default_resource());
+    REQUIRE(NRef<Array>(json["a"]).resource() == NRef<Object>(json.root()).resource());
+  }
+  SECTION("Nodes created outside of a parse come from the default resource.", "[JSON][Arena]")
+  {
+    json.setArenaMode(true);
+    json.parse(BufferSource{ R"([1])" });
+    const Node object = Node::make<Object>();
+    REQUIRE(NRef<Object>(object).resource() == std::pmr::get_default_resource());
+  }
+  SECTION("Arena and heap parses of example files stringify the same.", "[JSON][Arena]")
+  {
+    TEST_FILE_LIST(testFile);
+    const std::string text{ JSON::fromFile(prefixTestDataPath(testFile)) };
+    json.parse(BufferSource{ text });
+    const auto expected = json.stringifyToString();
+    json.setArenaMode(true);
+    json.parse(BufferSource{ text });
+    REQUIRE(json.stringifyToString() == expected);
+    json.parse(BufferSource{ text });
+    REQUIRE(json.stringifyToString() == expected);
+  }
+  SECTION("Failed parse leaves the previous arena tree intact.", "[JSON][Arena]")
+  {
+    json.setArenaMode(true);
+    json.parse(BufferSource{ R"({"key":"a value long enough to need its own allocation"})" });
+    REQUIRE_THROWS_AS(json.parse(BufferSource{ R"({"key":)" }), SyntaxError);
+    REQUIRE(json.stringifyToString() == R"({"key":"a value long enough to need its own allocation"})");
+    const auto result = json.parseResult(BufferSource{ "[1," });
+    REQUIRE_FALSE(result.ok());
+    REQUIRE(json.stringifyToString() == R"({"key":"a value long enough to need its own allocation"})");
+  }
+  SECTION("Arena tree can be modified with heap nodes then re-parsed.", "[JSON][Arena]")
+  {
+    json.setArenaMode(true);
+    json.parse(BufferSource{ R"({"list":[1,2]})" });
+    json["extra"] = Node::make<Object>();
+    NRef<Object>(json["extra"]).add(Object::Entry("name", Node::make<String>("a string long enough to need the heap")));
+    NRef<Array>(json["list"]).add(Node::make<String>("another string long enough to need the heap"));
+    REQUIRE(json.stringifyToString()
+            == R"({"list":[1,2,"another string long enough to need the heap"],"extra":{"name":"a string long enough to need the heap"}})");
+    json.parse(BufferSource{ "[true]" });
+    REQUIRE(json.stringifyToString() == "[true]");
+    json.setArenaMode(false);
+    json.parse(BufferSource{ "[false]" });
+    REQUIRE(NRef<Array>(json.root()).resource() == std::pmr::get_default_resource());
+    REQUIRE(json.stringifyToString() == "[false]");
+  }
+  SECTION("Node resource scope is restored on exit.", "[JSON][Arena]")
+  {
+    std::pmr::monotonic_buffer_resource arena;
+    {
+      const detail::ScopedNodeResource scope{ &arena };
+      REQUIRE(detail::nodeResource() == &arena);
+      const Node array = Node::make<Array>();
+      REQUIRE(NRef<Array>(array).resource() == &arena);
+    }
+    REQUIRE(detail::nodeResource() == std::pmr::get_default_resource());
+  }
+}
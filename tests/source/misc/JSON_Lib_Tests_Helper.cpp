@@ -99,6 +99,17 @@ std::string stripWhiteSpace(const std::string &jsonBuffer)
   return destination.toString();
 }
 /// <summary>
+/// Stringify a Node to compact JSON text.
+/// </summary>
+/// <param name="jNode">Node to stringify</param>
+/// <returns>Compact JSON text</returns>
+std::string nodeText(const Node &jNode)
+{
+  BufferDestination destination;
+  Default_Stringify().stringify(jNode, destination, 0);
+  return destination.toString();
+}
+/// <summary>
 /// Generate unique file name.
 /// </summary>
 /// <returns>Unique torrent file name</returns>
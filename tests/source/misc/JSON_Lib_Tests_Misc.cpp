@@ -1,5 +1,7 @@
 #include "JSON_Lib_Tests.hpp"
 
+#include <thread>
+
 TEST_CASE("Check translation of surrogate pairs.", "[JSON][Translator]")
 {
   Default_Translator translator;
@@ -149,6 +151,80 @@ TEST_CASE("Check white space stripping.", "[JSON][Parse][Strip]")
     json.strip(jsonSource, strippedDestination);
     REQUIRE(strippedDestination.toString() == "[\"fffgh \\/ \\n\\t \\p \\w \\u1234 \"]");
   }
+  SECTION("Strip JSON keeping whitespace, quotes and escapes inside strings.", "[JSON][Parse][Strip]")
+  {
+    BufferSource jsonSource{ R"({ "a b" :	"x\" y\\" ,
+   "c\\\"" : [ 1 , " \\ " ] } )" };
+    BufferDestination strippedDestination;
+    json.strip(jsonSource, strippedDestination);
+    REQUIRE(strippedDestination.toString() == R"({"a b":"x\" y\\","c\\\"":[1," \\ "]})");
+    REQUIRE_FALSE(jsonSource.more());
+  }
+  SECTION("Strip large JSON from buffer and file with strings and escapes spanning read blocks.", "[JSON][Parse][Strip]")
+  {
+    std::string pretty{ "[\r\n" };
+    std::string stripped{ "[" };
+    for (int index = 0; index < 5000; index++) {
+      const std::string entry{ R"({"key )" + std::to_string(index) + R"( \" \\":"  value \\\" with   spaces  "})" };
+      pretty += "    " + entry + (index < 4999 ? " ,\r\n" : "\r\n");
+      stripped += entry + (index < 4999 ? "," : "");
+    }
+    pretty += "]\r\n";
+    stripped += "]";
+    BufferDestination fromBuffer;
+    json.strip(BufferSource{ pretty }, fromBuffer);
+    REQUIRE(fromBuffer.toString() == stripped);
+    const std::string prettyFileName{ generateRandomFileName() };
+    const std::string strippedFileName{ generateRandomFileName() };
+    {
+      std::ofstream out{ prettyFileName, std::ios::binary };
+      out << pretty;
+    }
+    json.strip(FileSource{ prettyFileName }, FileDestination{ strippedFileName });
+    REQUIRE(JSON::fromFile(strippedFileName) == stripped);
+    std::filesystem::remove(prettyFileName);
+    std::filesystem::remove(strippedFileName);
+  }
+  SECTION("Strip with validation of well-formed JSON.", "[JSON][Parse][Strip][Validate]")
+  {
+    BufferDestination fromBuffer;
+    json.strip(BufferSource{ R"(  { "a" : [ 1 , true , null ] }  )" }, fromBuffer, true);
+    REQUIRE(fromBuffer.toString() == R"({"a":[1,true,null]})");
+    const std::string generatedFileName{ generateRandomFileName() };
+    JSON::toFile(generatedFileName, R"(  { "a" : [ 1 , true , null ] }  )");
+    BufferDestination fromFile;
+    json.strip(FileSource{ generatedFileName }, fromFile, true);
+    REQUIRE(fromFile.toString() == R"({"a":[1,true,null]})");
+    std::filesystem::remove(generatedFileName);
+  }
+  SECTION("Strip with validation of a partly read file keeps the read position.", "[JSON][Parse][Strip][Validate]")
+  {
+    const std::string generatedFileName{ generateRandomFileName() };
+    JSON::toFile(generatedFileName, "skip\r\n  { \"a\" : [ 1 , true ] }  ");
+    FileSource jsonSource{ generatedFileName };
+    jsonSource.advance(5);
+    BufferDestination strippedDestination;
+    json.strip(jsonSource, strippedDestination, true);
+    REQUIRE(strippedDestination.toString() == R"({"a":[1,true]})");
+    jsonSource.close();
+    std::filesystem::remove(generatedFileName);
+  }
+  SECTION("Strip with validation of malformed JSON throws.", "[JSON][Parse][Strip][Validate]")
+  {
+    BufferDestination strippedDestination;
+    REQUIRE_THROWS_WITH(json.strip(BufferSource{ R"({ "a" : [ 1 , 2 })" }, strippedDestination, true),
+      "JSON Syntax Error [Line: 1 Column: 17]: Missing closing ']' in array definition.");
+    REQUIRE_THROWS_WITH(json.strip(BufferSource{ R"([1, 2] 3)" }, strippedDestination, true),
+      "JSON Syntax Error [Line: 1 Column: 8]: Unexpected characters after end of JSON.");
+    REQUIRE_THROWS_WITH(json.strip(BufferSource{ R"({"a":1,"b":{"a":2},"a":3})" }, strippedDestination, true),
+      "Node Error: Duplicate key used to add object entry.");
+    const std::string generatedFileName{ generateRandomFileName() };
+    JSON::toFile(generatedFileName, "[1,\n tru ]");
+    REQUIRE_THROWS_WITH(json.strip(FileSource{ generatedFileName }, strippedDestination, true),
+      "JSON Syntax Error [Line: 2 Column: 6]: Invalid boolean value.");
+    std::filesystem::remove(generatedFileName);
+    REQUIRE(strippedDestination.toString().empty());
+  }
 }
 
 TEST_CASE("Check standard escape sequence translation.", "[JSON][Translator]")
@@ -180,6 +256,45 @@ TEST_CASE("Check standard escape sequence translation.", "[JSON][Translator]")
   }
 }
 
+TEST_CASE("Check escaping of raw UTF-8 strings.", "[JSON][Translator][Escape]")
+{
+  Default_Translator translator;
+  SECTION("Translate to escapes in long strings at every offset.", "[JSON][Translator][Escape]")
+  {
+    for (std::size_t offset = 0; offset < 40; offset++) {
+      const std::string padding(offset, 'a');
+      REQUIRE(translator.to(padding + "\"" + padding) == padding + R"(\")" + padding);
+      REQUIRE(translator.to(padding + "\x7F" + padding) == padding + R"(\u007F)" + padding);
+      REQUIRE(translator.to(padding + "\x01" + padding) == padding + R"(\u0001)" + padding);
+      REQUIRE(translator.to(padding + "\xC3\xA9" + padding) == padding + R"(\u00E9)" + padding);
+    }
+  }
+  SECTION("Translate to escapes for two, three and four byte UTF-8 sequences.", "[JSON][Translator][Escape]")
+  {
+    REQUIRE(translator.to("\xC2\x80\xDF\xBF") == R"(\u0080\u07FF)");
+    REQUIRE(translator.to("\xE0\xA0\x80\xEF\xBF\xBF") == R"(\u0800\uFFFF)");
+    REQUIRE(translator.to("\xF0\x90\x80\x80\xF4\x8F\xBF\xBF") == R"(\uD800\uDC00\uDBFF\uDFFF)");
+  }
+  SECTION("Translate to of malformed UTF-8 then expect exception.", "[JSON][Translator][Escape][Exception]")
+  {
+    for (const std::string malformed : { "\xC3", "\xC0\xAF", "\xE0\x80\x80", "\xF4\x90\x80\x80", "\x80", "\xC3z", "\xFF" }) {
+      REQUIRE_THROWS_WITH(translator.to("abc" + malformed), "ITranslator Error: Invalid UTF-8 character sequence.");
+    }
+  }
+  SECTION("Translate to of a null character then expect exception.", "[JSON][Translator][Escape][Exception]")
+  {
+    REQUIRE_THROWS_AS(translator.to(std::string("abc\0def", 7)), JSON_Lib::Error);
+  }
+  SECTION("Translate to destination gives the same result as to().", "[JSON][Translator][Escape]")
+  {
+    const std::string raw{ std::string(100, 'x') + "\t\xE2\x82\xAC\"" + std::string(100, 'y') };
+    BufferDestination destination;
+    translator.addTo(raw, destination);
+    REQUIRE(destination.toString() == translator.to(raw));
+    REQUIRE(destination.toString() == std::string(100, 'x') + R"(\t\u20AC\")" + std::string(100, 'y'));
+  }
+}
+
 TEST_CASE("Check JSON::version() api.", "[JSON][Version]")
 {
   SECTION("version() returns a non-empty string.", "[JSON][Version]") { REQUIRE_FALSE(JSON::version().empty()); }
@@ -188,3 +303,57 @@ TEST_CASE("Check JSON::version() api.", "[JSON][Version]")
     REQUIRE(JSON::version().find("1.2.0") != std::string::npos);
   }
 }
+
+TEST_CASE("Check UTF-8/UTF-16 conversion.", "[JSON][Converter]")
+{
+  const std::u8string mixed{ u8"ASCII text long enough for a block é ß € 中文 \U0001D11E \U0010FFFF end" };
+  const std::string utf8{ mixed.begin(), mixed.end() };
+  const std::u16string utf16{ u"ASCII text long enough for a block é ß € 中文 \U0001D11E \U0010FFFF end" };
+  SECTION("Convert UTF-8 to UTF-16 and back.", "[JSON][Converter]")
+  {
+    REQUIRE(toUtf16(utf8) == utf16);
+    REQUIRE(toUtf8(utf16) == utf8);
+    REQUIRE(toUtf16("").empty());
+    REQUIRE(toUtf8(u"").empty());
+  }
+  SECTION("Convert strings with non-ASCII at every offset.", "[JSON][Converter]")
+  {
+    for (std::size_t offset = 0; offset < 40; offset++) {
+      const std::string padding(offset, 'a');
+      const std::u16string padding16(offset, u'a');
+      REQUIRE(toUtf16(padding + "\xC3\xA9" + padding) == padding16 + u"\u00E9" + padding16);
+      REQUIRE(toUtf8(padding16 + u"\u00E9" + padding16) == padding + "\xC3\xA9" + padding);
+    }
+  }
+  SECTION("Convert malformed UTF-8 then expect exception.", "[JSON][Converter][Exception]")
+  {
+    for (const std::string malformed : { "\xC3", "\xC0\xAF", "\xE0\x80\x80", "\xF4\x90\x80\x80", "\x80", "\xFF" }) {
+      REQUIRE_THROWS_WITH(toUtf16("abc" + malformed), "JSON Error: Invalid UTF-8 character sequence.");
+    }
+  }
+  SECTION("Convert UTF-16 with unpaired surrogates then expect exception.", "[JSON][Converter][Exception]")
+  {
+    for (const std::u16string malformed : { u"\xD834", u"\xDD1E", u"\xD834" u"a" }) {
+      REQUIRE_THROWS_WITH(toUtf8(u"abc" + malformed), "JSON Error: Invalid UTF-16 character sequence.");
+    }
+  }
+  SECTION("Convert a null character then expect exception.", "[JSON][Converter][Exception]")
+  {
+    REQUIRE_THROWS_WITH(toUtf16(std::string("a\0b", 3)), "JSON Error: Tried to convert a null character.");
+    REQUIRE_THROWS_WITH(toUtf8(std::u16string(u"a\0b", 3)), "JSON Error: Tried to convert a null character.");
+  }
+  SECTION("Convert on several threads at once.", "[JSON][Converter][Threads]")
+  {
+    std::vector<std::thread> workers;
+    std::atomic<int> failures{ 0 };
+    for (int worker = 0; worker < 4; worker++) {
+      workers.emplace_back([&] {
+        for (int count = 0; count < 1000; count++) {
+          if (toUtf8(toUtf16(utf8)) != utf8) { failures++; }
+        }
+      });
+    }
+    for (auto &worker : workers) { worker.join(); }
+    REQUIRE(failures == 0);
+  }
+}
@@ -201,4 +201,38 @@ TEST_CASE("Check use of Node constructors.", "[JSON][Node][Constructor]")
     REQUIRE(NRef<Number>(dest).value<int>() == 42);
     REQUIRE(source.isEmpty());
   }
+  SECTION("Node is a compact 16 byte tagged value.", "[JSON][Node][Constructor][Layout]")
+  {
+    REQUIRE(sizeof(Node) == 16);
+    REQUIRE(sizeof(Number) <= 12);
+  }
+  SECTION("Node move keeps every kind of value intact.", "[JSON][Node][Constructor]")
+  {
+    std::vector<Node> nodes;
+    nodes.emplace_back(123456789012345ll);
+    nodes.emplace_back(0.1L);
+    nodes.emplace_back("a string too long to be held in any small buffer");
+    nodes.emplace_back(false);
+    nodes.emplace_back(nullptr);
+    nodes.emplace_back(Node::make<Hole>());
+    nodes.emplace_back(Node{ 1, 2, 3 });
+    nodes.emplace_back(Node{ { "key", 1 } });
+    for (int count = 0; count < 64; count++) { nodes.emplace_back(count); }
+    REQUIRE(NRef<Number>(nodes[0]).value<long long>() == 123456789012345ll);
+    REQUIRE(NRef<Number>(nodes[1]).is<long double>());
+    REQUIRE(NRef<Number>(nodes[1]).value<long double>() == 0.1L);
+    REQUIRE(NRef<String>(nodes[2]).value() == "a string too long to be held in any small buffer");
+    REQUIRE_FALSE(NRef<Boolean>(nodes[3]).value());
+    REQUIRE(isA<Null>(nodes[4]));
+    REQUIRE(isA<Hole>(nodes[5]));
+    REQUIRE(NRef<Array>(nodes[6]).size() == 3);
+    REQUIRE(NRef<Object>(nodes[7]).contains("key"));
+    REQUIRE(NRef<Number>(nodes[71]).value<int>() == 63);
+  }
+  SECTION("Node get of the wrong type throws.", "[JSON][Node][Constructor]")
+  {
+    Node jNode(42);
+    REQUIRE_THROWS_AS(jNode.get<String>(), std::bad_variant_access);
+    REQUIRE_THROWS_AS(Node().get<Number>(), std::bad_variant_access);
+  }
 }
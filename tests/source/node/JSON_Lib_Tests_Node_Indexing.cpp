@@ -147,4 +147,78 @@ TEST_CASE("Check Node indexing on directly constructed nodes.", "[JSON][Node][In
     REQUIRE(NRef<Number>(jNode["x"]).value<int>() == 1);
     REQUIRE(NRef<Number>(jNode["y"]).value<int>() == 2);
   }
-}
\ No newline at end of file
+  SECTION("Object lookup and duplicate keys either side of the linear scan size.", "[JSON][Node][Index]")
+  {
+    Node jNode = Node::make<Object>();
+    auto &object = NRef<Object>(jNode);
+    for (int entry = 0; entry < 40; entry++) {
+      object.add(Object::Entry("key" + std::to_string(entry), Node(entry)));
+      REQUIRE_THROWS_AS(object.add(Object::Entry("key0", Node(0))), Node::Error);
+      REQUIRE_THROWS_AS(object.add(Object::Entry("key" + std::to_string(entry), Node(0))), Node::Error);
+      for (int key = 0; key <= entry; key++) {
+        REQUIRE(NRef<Number>(object["key" + std::to_string(key)]).value<int>() == key);
+      }
+      REQUIRE_FALSE(object.contains("key" + std::to_string(entry + 1)));
+    }
+    REQUIRE(object.size() == 40);
+  }
+  SECTION("Object lookup of keys of every length up to and past the hash block size.", "[JSON][Node][Index]")
+  {
+    Node jNode = Node::make<Object>();
+    auto &object = NRef<Object>(jNode);
+    std::string key;
+    for (int length = 0; length < 120; length++) {
+      object.add(Object::Entry(key, Node(length)));
+      key += static_cast<char>('a' + length % 26);
+    }
+    key.clear();
+    for (int length = 0; length < 120; length++) {
+      REQUIRE(NRef<Number>(object[key]).value<int>() == length);
+      REQUIRE_FALSE(object.contains(key + "!"));
+      key += static_cast<char>('a' + length % 26);
+    }
+  }
+  SECTION("Object key hash depends on its seed.", "[JSON][Node][Index]")
+  {
+    REQUIRE(detail::keyHash("key", 1) == detail::keyHash("key", 1));
+    REQUIRE(detail::keyHash("key", 1) != detail::keyHash("key", 2));
+    REQUIRE(detail::keyHash("key", 1) != detail::keyHash("kez", 1));
+    REQUIRE(detail::hashKey("key") == detail::hashKey("key"));
+  }
+  SECTION("Object try_emplace adds a Hole for a new key and finds an existing one.", "[JSON][Node][Index]")
+  {
+    Node jNode = Node::make<Object>();
+    auto &object = NRef<Object>(jNode);
+    for (int entry = 0; entry < 20; entry++) {
+      auto [added, inserted] = object.try_emplace("key" + std::to_string(entry));
+      REQUIRE(inserted);
+      REQUIRE(isA<Hole>(added));
+      added = entry;
+      auto [found, again] = object.try_emplace("key" + std::to_string(entry));
+      REQUIRE_FALSE(again);
+      REQUIRE(NRef<Number>(found).value<int>() == entry);
+    }
+    REQUIRE(object.size() == 20);
+  }
+  SECTION("Node try_emplace turns a Hole or empty node into an object.", "[JSON][Node][Index]")
+  {
+    Node hole = Node::make<Hole>();
+    REQUIRE(hole.try_emplace("a").second);
+    REQUIRE(isA<Object>(hole));
+    Node empty;
+    empty.try_emplace("b").first = 2;
+    REQUIRE(NRef<Number>(empty["b"]).value<int>() == 2);
+    Node number(1);
+    REQUIRE_THROWS_AS(number.try_emplace("c"), Node::Error);
+  }
+  SECTION("JSON key indexing creates missing keys of a large object.", "[JSON][Node][Index]")
+  {
+    JSON json;
+    for (int entry = 0; entry < 100; entry++) { json["key" + std::to_string(entry)] = entry; }
+    for (int entry = 0; entry < 100; entry++) {
+      REQUIRE(NRef<Number>(json["key" + std::to_string(entry)]).value<int>() == entry);
+    }
+    REQUIRE(NRef<Object>(json.root()).size() == 100);
+    REQUIRE_THROWS_WITH(json.root()["missing"], "Node Error: Invalid key used to access object.");
+  }
+}
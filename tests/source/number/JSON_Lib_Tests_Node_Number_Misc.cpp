@@ -162,4 +162,138 @@ TEST_CASE("Check Number setPrecision() and setNotation().", "[JSON][Node][Number
     // precision 2 on 3.14 in defaultfloat should give "3.1"
     REQUIRE(result == "3.1");
   }
-}
\ No newline at end of file
+  SECTION("Shortest notation round trips and ignores precision.", "[JSON][Node][Number]")
+  {
+    Number::setPrecision(2);
+    Number::setNotation(Number::numberNotation::shortest);
+    const Number pi{ 3.141592653589793 };
+    const Number whole{ 100.0 };
+    const Number large{ 1e300 };
+    const auto piText = pi.toString();
+    const auto wholeText = whole.toString();
+    const auto largeText = large.toString();
+    Number::setPrecision(6);
+    Number::setNotation(Number::numberNotation::normal);
+    REQUIRE(piText == "3.141592653589793");
+    REQUIRE(wholeText == "100.0");
+    REQUIRE(largeText == "1e+300");
+  }
+  SECTION("toChars() writes the same text as toString() without allocating.", "[JSON][Node][Number]")
+  {
+    Number::CharsBuffer buffer;
+    for (const auto &number : { Number{ 42 }, Number{ -9223372036854775807LL }, Number{ 3.14f }, Number{ 1e-7 } }) {
+      REQUIRE(number.toChars(buffer) == number.toString());
+    }
+  }
+  SECTION("Values too long for toChars() still convert with toString().", "[JSON][Node][Number]")
+  {
+    Number::setNotation(Number::numberNotation::fixed);
+    const Number large{ 1e300 };
+    Number::CharsBuffer buffer;
+    const auto chars = large.toChars(buffer);
+    const auto text = large.toString();
+    Number::setNotation(Number::numberNotation::normal);
+    REQUIRE(chars.empty());
+    REQUIRE(text.size() == 308);
+    REQUIRE(text.ends_with(".000000"));
+    REQUIRE(Number{ std::string_view{ text } }.value<double>() == 1e300);
+  }
+}
+TEST_CASE("Check Node Number conversion from text.", "[JSON][Node][Number]")
+{
+  SECTION("Conversion does not depend on the text being null terminated.", "[JSON][Node][Number]")
+  {
+    const std::string_view text{ "1.25999" };
+    const Number number{ text.substr(0, 4) };
+    REQUIRE(number.is<float>());
+    REQUIRE(number.value<float>() == 1.25f);
+  }
+  SECTION("Leading plus sign is accepted for floating point.", "[JSON][Node][Number]")
+  {
+    const Number number{ std::string_view{ "+2.5" } };
+    REQUIRE(number.is<float>());
+    REQUIRE(number.value<float>() == 2.5f);
+  }
+  SECTION("Values too large for a float are held as a double.", "[JSON][Node][Number]")
+  {
+    const Number number{ std::string_view{ "1e300" } };
+    REQUIRE(number.is<double>());
+    REQUIRE(number.value<double>() == 1e300);
+  }
+  SECTION("Hexadecimal is not a number.", "[JSON][Node][Number]")
+  {
+    const Number number{ std::string_view{ "0x1A" } };
+    REQUIRE_FALSE(number.isValid());
+  }
+}
+TEST_CASE("Check Node Number one pass classification matches trying each type in turn.", "[JSON][Node][Number]")
+{
+  // Reference: the first of int, long, long long, float, double, long double that converts all of the text
+  const auto reference = [](const std::string_view &text) {
+    Number number;
+    const auto convert = [&text, &number]<typename T>(T value) {
+      const char *first = text.data();
+      if constexpr (std::is_floating_point_v<T>) {
+        if (!text.empty() && text.front() == '+') { first++; }
+      }
+      const auto [ptr, ec] = std::from_chars(first, text.data() + text.size(), value);
+      if (ec != std::errc() || ptr != text.data() + text.size()) { return false; }
+      number = Number{ value };
+      return true;
+    };
+    convert(0) || convert(0L) || convert(0LL) || convert(0.0f) || convert(0.0) || convert(0.0L);
+    return number;
+  };
+  const auto text = GENERATE(values<std::string>({ "0",
+    "-0",
+    "007",
+    "2147483647",
+    "2147483648",
+    "-2147483648",
+    "-2147483649",
+    "999999999999999999",
+    "9223372036854775807",
+    "9223372036854775808",
+    "-9223372036854775808",
+    "123456789012345678901234",
+    "3.14",
+    "-0.0",
+    "0.000123",
+    "16777216.5",
+    "16777217",
+    "1.6777217",
+    "39.068341",
+    "-70.741615",
+    "1e10",
+    "1e-10",
+    "1E+5",
+    "2.5e-3",
+    "1e11",
+    "1e-11",
+    "1e38",
+    "3.5e38",
+    "1e-50",
+    "1e300",
+    "1e400",
+    "0.1234567890123456789012",
+    "+1.5",
+    "1.",
+    ".5",
+    "-",
+    "1e",
+    "1e+",
+    "1.2.3",
+    "12a" }));
+  const Number expected{ reference(text) };
+  const Number number{ std::string_view{ text } };
+  REQUIRE(number.isValid() == expected.isValid());
+  if (expected.isValid()) {
+    REQUIRE(number.is<int>() == expected.is<int>());
+    REQUIRE(number.is<long>() == expected.is<long>());
+    REQUIRE(number.is<long long>() == expected.is<long long>());
+    REQUIRE(number.is<float>() == expected.is<float>());
+    REQUIRE(number.is<double>() == expected.is<double>());
+    REQUIRE(number.is<long double>() == expected.is<long double>());
+    REQUIRE(number.toString() == expected.toString());
+  }
+}
@@ -0,0 +1,123 @@
+#include "JSON_Lib_Tests.hpp"
+
+namespace {
+// Parse text with borrowed strings turned on, returning the stringified result or error text.
+std::string borrowedParse(JSON &json, const std::string &text)
+{
+  json.setBorrowedStrings(true);
+  try {
+    json.parse(BufferSource{ text });
+    return json.stringifyToString();
+  } catch (const std::exception &ex) {
+    return ex.what();
+  }
+}
+}// namespace
+
+TEST_CASE("Check borrowed string parse mode.", "[JSON][Parse][Borrowed]")
+{
+  JSON json;
+  SECTION("Borrowed strings are off by default and can be toggled.", "[JSON][Parse][Borrowed]")
+  {
+    REQUIRE_FALSE(json.getBorrowedStrings());
+    json.setBorrowedStrings(true);
+    REQUIRE(json.getBorrowedStrings());
+    json.setBorrowedStrings(false);
+    REQUIRE_FALSE(json.getBorrowedStrings());
+  }
+  SECTION("Strings without escapes reference the source buffer.", "[JSON][Parse][Borrowed]")
+  {
+    const std::string text{ R"({"key":"value","list":["one","two"]})" };
+    json.setBorrowedStrings(true);
+    json.parse(BufferSource{ std::string_view{ text } });
+    const auto &value = NRef<String>(json["key"]);
+    REQUIRE(value.isBorrowed());
+    REQUIRE(value.value().data() == text.data() + text.find("value"));
+    REQUIRE(NRef<Object>(json.root()).value().front().getKey().data() == text.data() + text.find("key"));
+    REQUIRE(NRef<String>(json["list"][1]).value() == "two");
+  }
+  SECTION("Strings are copied when borrowing is off.", "[JSON][Parse][Borrowed]")
+  {
+    const std::string text{ R"({"key":"value"})" };
+    json.parse(BufferSource{ std::string_view{ text } });
+    REQUIRE_FALSE(NRef<String>(json["key"]).isBorrowed());
+  }
+  SECTION("Strings with escapes are decoded during the parse.", "[JSON][Parse][Borrowed]")
+  {
+    json.setBorrowedStrings(true);
+    json.parse(BufferSource{ R"(["a\tb\u0041\q"])" });
+    const auto &value = NRef<String>(json[0]);
+    REQUIRE_FALSE(value.isBorrowed());
+    REQUIRE(value.value() == "a\tbAq");
+  }
+  SECTION("Keys with escapes are decoded during the parse.", "[JSON][Parse][Borrowed]")
+  {
+    json.setBorrowedStrings(true);
+    json.parse(BufferSource{ R"({"k\u0065y":1})" });
+    REQUIRE(NRef<Object>(json.root()).contains("key"));
+  }
+  SECTION("Invalid escapes are reported by the parse.", "[JSON][Parse][Borrowed]")
+  {
+    json.setBorrowedStrings(true);
+    REQUIRE_THROWS_AS(json.parse(BufferSource{ R"(["\u00"])" }), ITranslator::Error);
+    REQUIRE_THROWS_AS(json.parse(BufferSource{ R"(["\uZZZZ"])" }), ITranslator::Error);
+    JSON structural{ nullptr, std::make_unique<Structural_Parser>() };
+    structural.setBorrowedStrings(true);
+    REQUIRE_THROWS_AS(structural.parse(BufferSource{ R"(["\uZZZZ"])" }), ITranslator::Error);
+  }
+  SECTION("Owned buffer is kept alive with the tree.", "[JSON][Parse][Borrowed]")
+  {
+    json.setBorrowedStrings(true);
+    json.parse(BufferSource{ std::string{ R"({"a string long enough to need the heap":"another long heap allocated string"})" } });
+    REQUIRE(NRef<String>(json["a string long enough to need the heap"]).isBorrowed());
+    REQUIRE(json.stringifyToString()
+            == R"({"a string long enough to need the heap":"another long heap allocated string"})");
+  }
+  SECTION("Modified and copied strings own their text.", "[JSON][Parse][Borrowed]")
+  {
+    json.setBorrowedStrings(true);
+    json.parse(BufferSource{ std::string{ R"(["abc","d\ne"])" } });
+    const String copy{ NRef<String>(json[0]) };
+    REQUIRE_FALSE(copy.isBorrowed());
+    REQUIRE(copy.value() == "abc");
+    NRef<String>(json[0]).append('d');
+    REQUIRE_FALSE(NRef<String>(json[0]).isBorrowed());
+    REQUIRE(NRef<String>(json[0]).value() == "abcd");
+    NRef<String>(json[1]).append('f');
+    REQUIRE(NRef<String>(json[1]).value() == "d\nef");
+  }
+  SECTION("Borrowed and copied parses of example files stringify the same.", "[JSON][Parse][Borrowed]")
+  {
+    TEST_FILE_LIST(testFile);
+    const std::string text{ JSON::fromFile(prefixTestDataPath(testFile)) };
+    json.parse(BufferSource{ text });
+    const auto expected = json.stringifyToString();
+    REQUIRE(borrowedParse(json, text) == expected);
+    json.setArenaMode(true);
+    REQUIRE(borrowedParse(json, text) == expected);
+  }
+  SECTION("Structural parser borrows strings the same way.", "[JSON][Parse][Borrowed]")
+  {
+    JSON structural{ nullptr, std::make_unique<Structural_Parser>() };
+    const std::string text{ R"({"key":"value","esc":"a\"b","key2":[1,"x"]})" };
+    REQUIRE(borrowedParse(structural, text) == borrowedParse(json, text));
+    structural.parse(BufferSource{ std::string_view{ text } });
+    REQUIRE(NRef<String>(structural["key"]).value().data() == text.data() + text.find("value"));
+    REQUIRE(NRef<String>(structural["esc"]).value() == "a\"b");
+    REQUIRE(NRef<Object>(structural.root()).contains("key2"));
+  }
+  SECTION("Malformed input reports the same errors as a copying parse.", "[JSON][Parse][Borrowed]")
+  {
+    const auto text
+      = GENERATE(values<std::string>({ R"({ "one" : "Apple })", R"({ "key" 4444})", R"([\"a"])", R"(["abc)", R"(["abc\)",
+        R"(["\uZZZZ"])", R"({"\uD800":1})" }));
+    JSON copying;
+    std::string expected;
+    try {
+      copying.parse(BufferSource{ text });
+    } catch (const std::exception &ex) {
+      expected = ex.what();
+    }
+    REQUIRE(borrowedParse(json, text) == expected);
+  }
+}
@@ -163,6 +163,26 @@ TEST_CASE("Check JSON object for decoding of strings with escape characters.", "
     // '\q' is not a recognised JSON escape: the translator drops the '\' and keeps 'q'
     REQUIRE(NRef<String>(json.root()).value() == "abc q def");
   }
+  SECTION("Parse JSON string mixing raw UTF-8 with escapes and verify it is decoded as UTF-8.",
+    "[JSON][Parse][Escapes]")
+  {
+    const std::string source{ "\"caf\xC3\xA9 \\u00e9\\u00C9 \\uD834\\uDD1E\\t\xE2\x82\xAC\"" };
+    const std::string expected{ "caf\xC3\xA9 \xC3\xA9\xC3\x89 \xF0\x9D\x84\x9E\t\xE2\x82\xAC" };
+    json.parse(BufferSource{ source });
+    REQUIRE(NRef<String>(json.root()).value() == expected);
+    const std::string generatedFileName{ generateRandomFileName() };
+    JSON::toFile(generatedFileName, source);
+    json.parse(FileSource{ generatedFileName });
+    REQUIRE(NRef<String>(json.root()).value() == expected);
+    std::filesystem::remove(generatedFileName);
+  }
+  SECTION("Parse JSON string escapes for one, two and three byte UTF-8 characters.", "[JSON][Parse][Escapes]")
+  {
+    json.parse(BufferSource{ R"(["\u0041\u007f","\u0080\u07FF","\u0800\uFFFF"])" });
+    REQUIRE(NRef<String>(json.root()[0]).value() == "A\x7F");
+    REQUIRE(NRef<String>(json.root()[1]).value() == "\xC2\x80\xDF\xBF");
+    REQUIRE(NRef<String>(json.root()[2]).value() == "\xE0\xA0\x80\xEF\xBF\xBF");
+  }
 }
 
 TEST_CASE("Check JSON parser throws on invalid escape sequences.", "[JSON][Parse][Escapes][Exception]")
@@ -186,4 +206,32 @@ TEST_CASE("Check JSON parser throws on invalid escape sequences.", "[JSON][Parse
     BufferSource jsonSource{ R"("abcdefghijklmnopqrstuvwxyz \uD800 ")" };
     REQUIRE_THROWS_AS(json.parse(jsonSource), ITranslator::Error);
   }
+  SECTION("Parse JSON string with lone low surrogate '\\uDC00' and expect ITranslator::Error.",
+    "[JSON][Parse][Escapes][Exception]")
+  {
+    BufferSource jsonSource{ R"("abc \uDC00 def")" };
+    REQUIRE_THROWS_WITH(json.parse(jsonSource), "ITranslator Error: Unpaired surrogate found.");
+  }
+  SECTION("Parse JSON string with high surrogate at the end of the string and expect ITranslator::Error.",
+    "[JSON][Parse][Escapes][Exception]")
+  {
+    BufferSource jsonSource{ R"("abc \uD834")" };
+    REQUIRE_THROWS_WITH(json.parse(jsonSource), "ITranslator Error: Unpaired surrogate found.");
+  }
+  SECTION("Parse JSON string with signed '\\u' hex value and expect ITranslator::Error.",
+    "[JSON][Parse][Escapes][Exception]")
+  {
+    BufferSource jsonSource{ R"("abc \u+041 def")" };
+    REQUIRE_THROWS_WITH(json.parse(jsonSource), "ITranslator Error: Syntax error detected.");
+  }
+  SECTION("Parse JSON string with escapes longer than the maximum string length and expect error.",
+    "[JSON][Parse][Escapes][Exception]")
+  {
+    const auto defaultLength = getDefaultStringLength();
+    setDefaultStringLength(8);
+    REQUIRE_NOTHROW(json.parse(BufferSource{ R"("\t\t\t\t\t\t\t\t")" }));
+    REQUIRE_THROWS_WITH(json.parse(BufferSource{ R"("\t\t\t\t\t\t\t\t\t")" }),
+      "JSON Syntax Error: String size exceeds maximum allowed size.");
+    setDefaultStringLength(defaultLength);
+  }
 }
\ No newline at end of file
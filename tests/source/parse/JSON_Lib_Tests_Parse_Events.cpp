@@ -0,0 +1,125 @@
+#include "JSON_Lib_Tests.hpp"
+
+namespace {
+// Parser that only builds trees, so that its events come from IParser's default replay
+class TreeOnlyParser final : public IParser
+{
+public:
+  Node parse(ISource &source) override { return parser.parse(source); }
+
+private:
+  Default_Translator translator;
+  Default_Parser parser{ translator };
+};
+// Events raised by a parse of text or the error it reports.
+std::vector<std::string> eventsOf(JSON &json, const std::string &text)
+{
+  return textOrError([&](std::vector<std::string> &events) {
+    EventRecorder recorder;
+    json.parse(BufferSource{ text }, recorder);
+    events = std::move(recorder.events);
+  });
+}
+}// namespace
+
+TEST_CASE("Check parse events.", "[JSON][Parse][Events]")
+{
+  JSON json;
+  SECTION("Events for a small document arrive in document order.", "[JSON][Parse][Events]")
+  {
+    REQUIRE(eventsOf(json, R"({ "x" : [1, "a", true, false, null, {}, []], "y" : -2.5 })")
+            == std::vector<std::string>{
+              "{", "key:x", "[", "n:1", "s:a", "true", "false", "null", "{", "}", "[", "]", "]", "key:y", "n:-2.5", "}" });
+  }
+  SECTION("Scalar documents raise a single event.", "[JSON][Parse][Events]")
+  {
+    REQUIRE(eventsOf(json, R"("text")") == std::vector<std::string>{ "s:text" });
+    REQUIRE(eventsOf(json, "  42  ") == std::vector<std::string>{ "n:42" });
+    REQUIRE(eventsOf(json, "null") == std::vector<std::string>{ "null" });
+  }
+  SECTION("Numbers are stored in the same type as a tree parse would use.", "[JSON][Parse][Events]")
+  {
+    class NumberTypes final : public IEvents
+    {
+    public:
+      void onNumber(const Number &value) override
+      {
+        types.push_back(value.is<int>() ? "int" : value.is<long>() ? "long" : value.is<float>() ? "float" : "double");
+      }
+      std::vector<std::string> types;
+    } numberTypes;
+    json.parse(BufferSource{ "[1, 3000000000, 39.068341, 1e300]" }, numberTypes);
+    REQUIRE(numberTypes.types == std::vector<std::string>{ "int", "long", "float", "double" });
+  }
+  SECTION("Escapes in strings and keys are decoded.", "[JSON][Parse][Events]")
+  {
+    REQUIRE(eventsOf(json, R"({"k\u0065y":"a\tb\u0041\q"})")
+            == std::vector<std::string>{ "{", "key:key", "s:a\tbAq", "}" });
+  }
+  SECTION("Events do not build or change the tree.", "[JSON][Parse][Events]")
+  {
+    json.parse(BufferSource{ "[1]" });
+    EventRecorder recorder;
+    json.parse(BufferSource{ R"({"a":2})" }, recorder);
+    REQUIRE(json.stringifyToString() == "[1]");
+  }
+  SECTION("Events match the tree parsed from each example file.", "[JSON][Parse][Events]")
+  {
+    TEST_FILE_LIST(testFile);
+    const std::string text{ JSON::fromFile(prefixTestDataPath(testFile)) };
+    JSON replay{ nullptr, std::make_unique<TreeOnlyParser>() };
+    const auto expected = eventsOf(replay, text);
+    REQUIRE(eventsOf(json, text) == expected);
+    EventRecorder fromFile;
+    json.parse(FileSource{ prefixTestDataPath(testFile) }, fromFile);
+    REQUIRE(fromFile.events == expected);
+    JSON structural{ nullptr, std::make_unique<Structural_Parser>() };
+    REQUIRE(eventsOf(structural, text) == expected);
+  }
+  SECTION("Malformed input reports the same errors as a tree parse.", "[JSON][Parse][Events]")
+  {
+    const auto text = GENERATE(values<std::string>({ R"({ "one" : "Apple })",
+      R"({ "key" 4444})",
+      R"([\"a"])",
+      R"(["abc)",
+      R"([1,2)",
+      R"({"a":1)",
+      R"([tru])",
+      R"([nul])",
+      R"([1.2.3])",
+      R"(['a'])" }));
+    const auto expected = textOrError([&](std::vector<std::string> &) { json.parse(BufferSource{ text }); });
+    REQUIRE_FALSE(expected.empty());
+    REQUIRE(eventsOf(json, text) == expected);
+  }
+  SECTION("Maximum parser depth applies to events.", "[JSON][Parse][Events]")
+  {
+    const ScopedMaxDepth depth{ json, 4 };
+    REQUIRE(eventsOf(json, "[[1]]").size() == 5);
+    REQUIRE(eventsOf(json, "[[[1]]]")
+            == std::vector<std::string>{ "JSON Syntax Error: Maximum parser depth exceeded." });
+  }
+  SECTION("Errors are returned by parseResult.", "[JSON][Parse][Events]")
+  {
+    EventRecorder recorder;
+    REQUIRE(json.parseResult(BufferSource{ "[1,2]" }, recorder).ok());
+    const auto result = json.parseResult(BufferSource{ "[1,2" }, recorder);
+    REQUIRE(result.status == Status::SyntaxError);
+    REQUIRE(result.message == "JSON Syntax Error [Line: 1 Column: 5]: Missing closing ']' in array definition.");
+  }
+  SECTION("Exceptions thrown by a callback abandon the parse.", "[JSON][Parse][Events]")
+  {
+    class StopAtKey final : public IEvents
+    {
+    public:
+      void onKey(const std::string_view &key) override
+      {
+        if (key == "stop") { throw IEvents::Error("Stopped."); }
+        keys++;
+      }
+      int keys{};
+    } stopAtKey;
+    REQUIRE_THROWS_WITH(json.parse(BufferSource{ R"({"a":1,"stop":2,"b":3})" }, stopAtKey), "IEvents Error: Stopped.");
+    REQUIRE(stopAtKey.keys == 1);
+  }
+}
@@ -136,3 +136,108 @@ TEST_CASE("Check parser generated exceptions.", "[JSON][Parse][Exception]")
     REQUIRE_THROWS_WITH(json.parse(jsonSource), "JSON Syntax Error [Line: 2 Column: 12]: Invalid boolean value.");
   }
 }
+
+TEST_CASE("Check parseResult reports parser errors without throwing.", "[JSON][Parse][Exception][Result]")
+{
+  JSON json;
+  SECTION("Malformed JSON gives the status, message and position parse() throws.", "[JSON][Parse][Exception][Result]")
+  {
+    for (const std::string_view jsonText : std::initializer_list<std::string_view>{ R"({ "one" : "Apple })",
+           R"([1,2,3,])", R"({"a":1,})", R"([1,,2])", R"({123:"val"})", R"({"a" 1})", R"([1, tru])", R"([nul])",
+           R"([1.2.3])", "{\n\"key\" : trrue }", R"([1,2)", R"({"a":1)", " " }) {
+      BufferSource jsonSource{ jsonText };
+      std::string thrown;
+      try {
+        json.parse(jsonSource);
+      } catch (const SyntaxError &ex) {
+        thrown = ex.what();
+      }
+      const auto position = jsonSource.getPosition();
+      jsonSource.reset();
+      const auto result = json.parseResult(jsonSource);
+      REQUIRE_FALSE(result.ok());
+      REQUIRE(result.status == Status::SyntaxError);
+      REQUIRE_FALSE(result.value.has_value());
+      REQUIRE(result.message == thrown);
+      REQUIRE(result.position == position);
+    }
+  }
+  SECTION("JSON exceeding maximum parser depth.", "[JSON][Parse][Exception][Result]")
+  {
+    const ScopedMaxDepth scopedDepth(json, 3);
+    const auto result = json.parseResult(BufferSource{ R"([[[[1]]]])" });
+    REQUIRE(result.status == Status::SyntaxError);
+    REQUIRE(result.message == "JSON Syntax Error: Maximum parser depth exceeded.");
+  }
+  SECTION("Object with a duplicate key.", "[JSON][Parse][Exception][Result]")
+  {
+    BufferSource jsonSource{ R"({"a":1,"b":2,"a":3})" };
+    REQUIRE_THROWS_WITH(json.parse(jsonSource), "Node Error: Duplicate key used to add object entry.");
+    jsonSource.reset();
+    const auto result = json.parseResult(jsonSource);
+    REQUIRE(result.status == Status::UnknownError);
+    REQUIRE(result.message == "Node Error: Duplicate key used to add object entry.");
+  }
+  SECTION("String ending in an escape at the end of the buffer.", "[JSON][Parse][Exception][Result]")
+  {
+    BufferSource jsonSource{ R"(["abc\)" };
+    REQUIRE_THROWS_AS(json.parse(jsonSource), ISource::Error);
+    jsonSource.reset();
+    const auto result = json.parseResult(jsonSource);
+    REQUIRE(result.status == Status::UnknownError);
+    REQUIRE(result.message == "ISource Error: Tried to read past end of buffer.");
+  }
+  SECTION("Malformed string escapes give the error parse() throws.", "[JSON][Parse][Exception][Result]")
+  {
+    for (const std::string_view jsonText : std::initializer_list<std::string_view>{
+           R"(["\uZZZZ"])", R"(["\uD800"])", R"({"\uDC00":1})", R"(["\u0000"])", R"(["abc\u12"])" }) {
+      for (const std::string &text : { std::string{ jsonText }, std::string{ jsonText } + std::string(100, ' ') }) {
+        BufferSource jsonSource{ text };
+        std::string thrown;
+        try {
+          json.parse(jsonSource);
+        } catch (const std::exception &ex) {
+          thrown = ex.what();
+        }
+        REQUIRE_FALSE(thrown.empty());
+        const auto position = jsonSource.getPosition();
+        jsonSource.reset();
+        const auto result = json.parseResult(jsonSource);
+        REQUIRE(result.status == Status::UnknownError);
+        REQUIRE(result.message == thrown);
+        REQUIRE(result.position == position);
+      }
+    }
+  }
+  SECTION("Default_Translator reports malformed escapes without throwing.", "[JSON][Parse][Exception][Result]")
+  {
+    const Default_Translator translator;
+    std::string unescaped;
+    const char *message = nullptr;
+    REQUIRE_NOTHROW(translator.tryFrom(R"(\uZZZZ)", unescaped, message));
+    REQUIRE_FALSE(translator.tryFrom(R"(\uZZZZ)", unescaped, message));
+    REQUIRE(std::string_view{ message } == "Syntax error detected.");
+    REQUIRE_FALSE(translator.tryFrom(R"(a\uD800b)", unescaped, message));
+    REQUIRE(std::string_view{ message } == "Unpaired surrogate found.");
+    REQUIRE(translator.tryFrom(R"(a\u0041\tb)", unescaped, message));
+    REQUIRE(unescaped == "aA\tb");
+  }
+  SECTION("Parsed tree is held in the result.", "[JSON][Parse][Exception][Result]")
+  {
+    Default_Translator translator;
+    Default_Parser parser{ translator };
+    BufferSource jsonSource{ R"([1,2,3])" };
+    auto result = parser.parseResult(jsonSource);
+    REQUIRE(result.ok());
+    REQUIRE(result.value.has_value());
+    REQUIRE(NRef<Array>(result.unwrap()).size() == 3);
+  }
+  SECTION("Parser is usable again after an error.", "[JSON][Parse][Exception][Result]")
+  {
+    REQUIRE_FALSE(json.parseResult(BufferSource{ R"({"a":[1,2)" }).ok());
+    const auto result = json.parseResult(BufferSource{ R"({"a":[1,2]})" });
+    REQUIRE(result.ok());
+    REQUIRE(result.message.empty());
+    REQUIRE(json.stringifyToString() == R"({"a":[1,2]})");
+  }
+}
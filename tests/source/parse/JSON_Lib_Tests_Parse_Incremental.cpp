@@ -0,0 +1,126 @@
+#include "JSON_Lib_Tests.hpp"
+
+namespace {
+// Text of the whole of a text parsed in one go (or the error reported)
+std::vector<std::string> parsedTextOf(const std::string &text)
+{
+  return textOrError([&](std::vector<std::string> &values) {
+    JSON json;
+    json.parse(BufferSource{ text });
+    values.push_back(nodeText(json.root()));
+  });
+}
+// Feed text in chunks of a given size, returning the text of each value taken (or the error reported).
+std::vector<std::string> valuesOf(const std::string_view &text, const std::size_t chunkSize)
+{
+  return textOrError([&](std::vector<std::string> &values) {
+    Incremental_Parser parser;
+    for (std::size_t offset = 0; offset < text.size(); offset += chunkSize) {
+      parser.feed(text.substr(offset, chunkSize));
+      while (parser.available()) { values.push_back(nodeText(parser.take())); }
+    }
+    parser.finish();
+    while (parser.available()) { values.push_back(nodeText(parser.take())); }
+  });
+}
+}// namespace
+
+TEST_CASE("Check incremental parser.", "[JSON][Parse][Incremental]")
+{
+  SECTION("A document split at every byte parses as the whole document.", "[JSON][Parse][Incremental]")
+  {
+    const std::string text{ R"({ "a" : [1, -2.5e3, "x\"y\\", true, false, null], "bA" : { "c" : [] } })" };
+    const auto expected = parsedTextOf(text);
+    for (std::size_t split = 1; split < text.size(); split++) {
+      Incremental_Parser parser;
+      REQUIRE(parser.feed(std::string_view(text).substr(0, split)) == 0);
+      REQUIRE(parser.partial());
+      REQUIRE(parser.feed(std::string_view(text).substr(split)) == 1);
+      REQUIRE_FALSE(parser.partial());
+      REQUIRE(std::vector<std::string>{ nodeText(parser.take()) } == expected);
+    }
+  }
+  SECTION("Example files fed a byte at a time parse as the whole file.", "[JSON][Parse][Incremental]")
+  {
+    TEST_FILE_LIST(testFile);
+    const std::string text{ JSON::fromFile(prefixTestDataPath(testFile)) };
+    const auto expected = parsedTextOf(text);
+    REQUIRE(valuesOf(text, 1) == expected);
+    REQUIRE(valuesOf(text, 7) == expected);
+    REQUIRE(valuesOf(text, text.size()) == expected);
+  }
+  SECTION("A stream of values is returned one value at a time.", "[JSON][Parse][Incremental]")
+  {
+    const std::string text{ "1 [2]{\"a\":3}\n\"x\"true,null -4.5 \"\\\"\"" };
+    REQUIRE(valuesOf(text, 1)
+            == std::vector<std::string>{ "JSON Syntax Error [Line: 2 Column: 9]: Missing String, Number, Boolean, Array, Object or Null." });
+    const std::string stream{ "1 [2]{\"a\":3}\n\"x\"true null -4.5 \"\\\"\"" };
+    for (const std::size_t chunkSize : { 1, 2, 3, 5, 64 }) {
+      REQUIRE(valuesOf(stream, chunkSize)
+              == std::vector<std::string>{ "1", "[2]", R"({"a":3})", R"("x")", "true", "null", "-4.5", R"("\"")" });
+    }
+  }
+  SECTION("A trailing number is only complete at a delimiter or the end of the stream.", "[JSON][Parse][Incremental]")
+  {
+    Incremental_Parser parser;
+    REQUIRE(parser.feed("12") == 0);
+    REQUIRE(parser.feed("34") == 0);
+    REQUIRE(parser.partial());
+    REQUIRE(parser.finish() == 1);
+    REQUIRE(NRef<Number>(parser.take()).value<int>() == 1234);
+    REQUIRE(parser.feed("56 ") == 1);
+    REQUIRE(NRef<Number>(parser.take()).value<int>() == 56);
+    REQUIRE_FALSE(parser.available());
+    REQUIRE_THROWS_WITH(parser.take(), "IParser Error: No complete value to take.");
+  }
+  SECTION("Malformed input reports the same errors as a parse of the whole stream.", "[JSON][Parse][Incremental]")
+  {
+    const auto text = GENERATE(values<std::string>({ R"({ "one" : "Apple })",
+      R"({ "key" 4444})",
+      R"([\"a"])",
+      R"(["abc)",
+      R"([1,2)",
+      R"([1 2])",
+      R"({"a":1)",
+      "{\"a\":1,\n\"b\":2,\n  }",
+      R"([tru])",
+      R"(nul)",
+      R"([1.2.3])",
+      "[1.2.3\n]",
+      R"({"a":1,"a":2})",
+      R"(["\uZZZZ"])",
+      R"(['a'])",
+      R"(])" }));
+    const auto expected = parsedTextOf(text);
+    REQUIRE(expected.front().find("Error") != std::string::npos);
+    for (const std::size_t chunkSize : { 1, 3, 64 }) { REQUIRE(valuesOf(text, chunkSize) == expected); }
+  }
+  SECTION("Errors in later values report their position in the stream.", "[JSON][Parse][Incremental]")
+  {
+    // Same position as for the failing value with the value before it blanked out
+    REQUIRE_THROWS_WITH(JSON().parse(BufferSource{ "   \n{\"a\":\n [2,}" }),
+      "JSON Syntax Error [Line: 3 Column: 6]: Missing String, Number, Boolean, Array, Object or Null.");
+    REQUIRE(valuesOf("[1]\n{\"a\":\n [2,}", 4)
+            == std::vector<std::string>{ "JSON Syntax Error [Line: 3 Column: 6]: Missing String, Number, Boolean, Array, Object or Null." });
+  }
+  SECTION("The parser must be reset after an error.", "[JSON][Parse][Incremental]")
+  {
+    Incremental_Parser parser;
+    REQUIRE(parser.feed("[1] ") == 1);
+    REQUIRE_THROWS(parser.feed("[1,}"));
+    REQUIRE(parser.available());
+    REQUIRE_THROWS_WITH(parser.feed("[2]"), "IParser Error: Parser must be reset after an error.");
+    parser.reset();
+    REQUIRE_FALSE(parser.available());
+    REQUIRE(parser.feed("[2]") == 1);
+    REQUIRE(nodeText(parser.take()) == "[2]");
+  }
+  SECTION("Maximum parser depth applies to each value.", "[JSON][Parse][Incremental]")
+  {
+    Incremental_Parser parser;
+    parser.setMaxParserDepth(4);
+    REQUIRE(parser.getMaxParserDepth() == 4);
+    REQUIRE(parser.feed("[[1]] ") == 1);
+    REQUIRE_THROWS_WITH(parser.feed("[[[1]]]"), "JSON Syntax Error: Maximum parser depth exceeded.");
+  }
+}
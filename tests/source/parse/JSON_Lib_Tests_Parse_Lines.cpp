@@ -0,0 +1,160 @@
+#include "JSON_Lib_Tests.hpp"
+
+namespace {
+// Read every document of a stream, returning the compact text of each (or the error reported).
+std::vector<std::string> documentsOf(ISource &source)
+{
+  return textOrError([&](std::vector<std::string> &documents) {
+    JSON json;
+    JSON_Lines_Reader reader{ source };
+    while (reader.read(json)) { documents.push_back(nodeText(json.root())); }
+  });
+}
+std::vector<std::string> documentsOf(const std::string &text)
+{
+  BufferSource source{ text };
+  return documentsOf(source);
+}
+}// namespace
+
+TEST_CASE("Check JSON Lines reader and writer.", "[JSON][Parse][Lines]")
+{
+  SECTION("Newline delimited documents are read one at a time.", "[JSON][Parse][Lines]")
+  {
+    REQUIRE(documentsOf("{\"a\":1}\n[1,2]\n\"x\"\n42\ntrue\nnull\n")
+            == std::vector<std::string>{ R"({"a":1})", "[1,2]", R"("x")", "42", "true", "null" });
+  }
+  SECTION("Concatenated documents, blank lines and CRLF line ends are accepted.", "[JSON][Parse][Lines]")
+  {
+    REQUIRE(documentsOf("\r\n{\"a\":1}{\"b\":2}\r\n\r\n [3] 4\r\n")
+            == std::vector<std::string>{ R"({"a":1})", R"({"b":2})", "[3]", "4" });
+    REQUIRE(documentsOf(" \n\n ").empty());
+  }
+  SECTION("Documents read from a file match those written to it.", "[JSON][Parse][Lines]")
+  {
+    const std::string fileName{ generateRandomFileName() };
+    std::vector<std::string> expected;
+    {
+      BufferDestination destination;
+      JSON_Lines_Writer writer{ destination };
+      TEST_FILE_LIST(testFile);
+      JSON json;
+      json.parse(FileSource{ prefixTestDataPath(testFile) });
+      writer.write(json);
+      writer.write(json.root());
+      REQUIRE(writer.count() == 2);
+      expected.assign(2, json.stringifyToString());
+      REQUIRE(destination.toString() == expected[0] + "\n" + expected[1] + "\n");
+      JSON::toFile(fileName, destination.toString());
+    }
+    FileSource source{ fileName };
+    REQUIRE(documentsOf(source) == expected);
+    std::filesystem::remove(fileName);
+  }
+  SECTION("Written documents occupy one line each.", "[JSON][Parse][Lines]")
+  {
+    BufferDestination destination;
+    JSON_Lines_Writer writer{ destination };
+    writer.write(JSON{ { "text", "line one\nline two" } });
+    writer.write(JSON{ 1, 2, 3 });
+    REQUIRE(destination.toString() == "{\"text\":\"line one\\nline two\"}\n[1,2,3]\n");
+    REQUIRE_THROWS_WITH(writer.write(Node{}), "JSON Error: No JSON to stringify.");
+    REQUIRE(writer.count() == 2);
+  }
+  SECTION("Errors report their line within the whole stream.", "[JSON][Parse][Lines]")
+  {
+    REQUIRE(documentsOf("[1]\n[2]\n{\"a\" 3}\n[4]\n")
+            == std::vector<std::string>{ "JSON Syntax Error [Line: 3 Column: 7]: Missing ':' in key value pair." });
+  }
+  SECTION("Exception-free reads report errors and the end of the stream.", "[JSON][Parse][Lines]")
+  {
+    BufferSource source{ "[1]\n[2,]\n" };
+    JSON json;
+    JSON_Lines_Reader reader{ source };
+    REQUIRE(reader.readResult(json).ok());
+    REQUIRE(reader.count() == 1);
+    const auto error = reader.readResult(json);
+    REQUIRE(error.status == Status::SyntaxError);
+    REQUIRE(json.stringifyToString() == "[1]");
+    BufferSource ended{ "[1]\n\n" };
+    JSON_Lines_Reader endedReader{ ended };
+    REQUIRE(endedReader.readResult(json).ok());
+    REQUIRE(endedReader.readResult(json).status == Status::NoData);
+    REQUIRE(endedReader.count() == 1);
+  }
+  SECTION("Reader settings of the JSON instance apply to every document.", "[JSON][Parse][Lines]")
+  {
+    BufferSource source{ "[[1]]\n[[[1]]]\n" };
+    JSON json;
+    json.setMaxParserDepth(4);
+    json.setArenaMode(true);
+    JSON_Lines_Reader reader{ source };
+    REQUIRE(reader.read(json));
+    REQUIRE_THROWS_WITH(reader.read(json), "JSON Syntax Error: Maximum parser depth exceeded.");
+  }
+}
+
+TEST_CASE("Check JSON Lines batch parse across threads.", "[JSON][Parse][Lines][Batch]")
+{
+  // Many records of varied shape (several blocks' worth), with blank lines and CRLF line ends
+  std::string buffer;
+  for (int record = 0; record < 5000; record++) {
+    buffer += "{\"id\":" + std::to_string(record) + ",\"name\":\"r\\u00e9cord " + std::to_string(record)
+              + "\",\"tags\":[1.5,true,null,\"x\"]}" + (record % 7 == 0 ? "\r\n\n" : "\n");
+  }
+  const auto sequential = documentsOf(buffer);
+  REQUIRE(sequential.size() == 5000);
+  SECTION("Records are returned in input order whatever the number of threads.", "[JSON][Parse][Lines][Batch]")
+  {
+    for (const unsigned int threads : { 0U, 1U, 2U, 3U, 8U }) {
+      const JSON_Lines_Batch batch{ threads };
+      REQUIRE(batch.threads() > 0);
+      std::vector<std::string> records;
+      for (const auto &record : batch.parse(buffer)) { records.push_back(nodeText(record)); }
+      REQUIRE(records == sequential);
+    }
+  }
+  SECTION("Records handed on as they are ready carry their offsets.", "[JSON][Parse][Lines][Batch]")
+  {
+    std::vector<std::pair<std::size_t, std::string>> records;
+    JSON_Lines_Batch{ 4 }.parse(
+      buffer, [&](const std::size_t offset, Node &&record) { records.emplace_back(offset, nodeText(record)); });
+    std::ranges::sort(records);
+    std::vector<std::string> inOrder;
+    bool atRecordStarts = true;
+    for (const auto &[offset, text] : records) {
+      atRecordStarts = atRecordStarts && buffer.compare(offset, 6, "{\"id\":") == 0;
+      inOrder.push_back(text);
+    }
+    REQUIRE(atRecordStarts);
+    REQUIRE(inOrder == sequential);
+  }
+  SECTION("The first malformed record is reported at its position in the buffer.", "[JSON][Parse][Lines][Batch]")
+  {
+    auto malformed = buffer + "[1,2]\n";
+    malformed.replace(malformed.find("\"id\":4000,") + 4, 1, " ");
+    malformed.replace(malformed.find("\"id\":1000,") + 4, 1, " ");
+    const auto expected = documentsOf(malformed).front();
+    REQUIRE(expected.find("Missing ':' in key value pair.") != std::string::npos);
+    REQUIRE_THROWS_WITH(JSON_Lines_Batch{ 4 }.parse(malformed), expected);
+    REQUIRE_THROWS_WITH(JSON_Lines_Batch{ 1 }.parse(malformed), expected);
+  }
+  SECTION("Exceptions thrown by the record callback are passed on.", "[JSON][Parse][Lines][Batch]")
+  {
+    REQUIRE_THROWS_WITH(JSON_Lines_Batch{ 4 }.parse(buffer, [](std::size_t, Node &&) { throw std::runtime_error("stop"); }),
+      "stop");
+  }
+  SECTION("Empty and blank buffers have no records.", "[JSON][Parse][Lines][Batch]")
+  {
+    REQUIRE(JSON_Lines_Batch{ 2 }.parse("").empty());
+    REQUIRE(JSON_Lines_Batch{ 2 }.parse("\n \r\n\n").empty());
+  }
+  SECTION("Maximum parser depth applies to each record.", "[JSON][Parse][Lines][Batch]")
+  {
+    JSON_Lines_Batch batch{ 2 };
+    batch.setMaxParserDepth(4);
+    REQUIRE(batch.getMaxParserDepth() == 4);
+    REQUIRE(batch.parse("[[1]]\n[[2]]\n").size() == 2);
+    REQUIRE_THROWS_WITH(batch.parse("[[1]]\n[[[2]]]\n"), "JSON Syntax Error: Maximum parser depth exceeded.");
+  }
+}
@@ -1,6 +1,48 @@
 #include "JSON_Lib_Tests.hpp"
 #include "Default_Parser.hpp"
 
+namespace {
+// Character-at-a-time source with no contiguous() span, forcing the parser down its ISource path.
+class StreamedSource final : public ISource
+{
+public:
+  explicit StreamedSource(const std::string &text) : text(text) {}
+  char current() const noexcept override { return more() ? text[offset] : static_cast<char>(EOF); }
+  void next() override
+  {
+    if (!more()) { throw Error("Tried to read past end of stream."); }
+    offset++;
+    column++;
+    if (current() == kLineFeed) {
+      lineNo++;
+      column = 1;
+    }
+  }
+  bool more() const noexcept override { return offset < text.size(); }
+  void reset() override
+  {
+    offset = 0;
+    lineNo = 1;
+    column = 1;
+  }
+  std::size_t position() const override { return offset; }
+
+private:
+  void backup(const unsigned long length) override { offset -= length; }
+  std::string text;
+  std::size_t offset{};
+};
+std::string parseError(JSON &json, ISource &source)
+{
+  try {
+    json.parse(source);
+  } catch (const std::exception &ex) {
+    return ex.what();
+  }
+  return {};
+}
+}// namespace
+
 TEST_CASE("Check JSON parsing of a list of example JSON files.", "[JSON][Parse][Examples]")
 {
   JSON json;
@@ -129,3 +171,46 @@ TEST_CASE("Check string max length can be configured.", "[JSON][Parse][String][M
   }
 }
 
+TEST_CASE("Check contiguous buffer parsing matches character-by-character parsing.", "[JSON][Parse][Contiguous]")
+{
+  JSON json;
+  SECTION("Parsed tree and final source position are the same for both paths.", "[JSON][Parse][Contiguous]")
+  {
+    const std::string text{ "  {\"a\" : [1, 2.5, -3e2, \"x\\ty\", true, false, null],\n \"b\": {\"c\": \"\\u00e9\"}}  \n" };
+    BufferSource contiguous{ text };
+    StreamedSource streamed{ text };
+    json.parse(contiguous);
+    const auto fromContiguous = json.stringifyToString();
+    json.parse(streamed);
+    REQUIRE(json.stringifyToString() == fromContiguous);
+    REQUIRE(contiguous.position() == streamed.position());
+    REQUIRE(contiguous.getPosition() == streamed.getPosition());
+  }
+  SECTION("Syntax errors report the same line and column for both paths.", "[JSON][Parse][Contiguous]")
+  {
+    const auto text = GENERATE(values<std::string>({ "{ \"one\" : \"Apple }",
+      "{\n\"key\" : trrue }",
+      "[1,\n2,\n  nul ]",
+      "{ \"one\" : 18987u3 }",
+      "{\n  \"one\" : 1\n  \"two\" : 2 }",
+      "[1,2,3,]",
+      "{ \"key\" 4444}",
+      "[1,2,3,4,5,6" }));
+    BufferSource contiguous{ text };
+    StreamedSource streamed{ text };
+    const auto contiguousError = parseError(json, contiguous);
+    REQUIRE_FALSE(contiguousError.empty());
+    REQUIRE(contiguousError == parseError(json, streamed));
+    REQUIRE(contiguous.getPosition() == streamed.getPosition());
+  }
+  SECTION("FixedBufferSource parses through the contiguous path from a mid-stream position.", "[JSON][Parse][Contiguous]")
+  {
+    constexpr char text[] = "x\n[1, {\"k\": \"v\"}]";
+    FixedBufferSource source{ text, sizeof(text) - 1 };
+    source.next();
+    json.parse(source);
+    REQUIRE(json.stringifyToString() == R"([1,{"k":"v"}])");
+    REQUIRE_FALSE(source.more());
+    REQUIRE(source.getPosition() == std::make_pair(2L, 17L));
+  }
+}
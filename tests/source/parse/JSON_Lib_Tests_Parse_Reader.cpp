@@ -0,0 +1,244 @@
+#include "JSON_Lib_Tests.hpp"
+
+namespace {
+// Read every token of a source, returning them as text (eg. "{", "key:x", "n:1", "s:a", "]") or the error reported.
+std::vector<std::string> tokensOf(ISource &source)
+{
+  return textOrError([&](std::vector<std::string> &tokens) {
+    Reader reader{ source };
+    while (reader.next() != Reader::Token::end) {
+      switch (reader.token()) {
+        case Reader::Token::objectStart:
+          tokens.emplace_back("{");
+          break;
+        case Reader::Token::objectEnd:
+          tokens.emplace_back("}");
+          break;
+        case Reader::Token::arrayStart:
+          tokens.emplace_back("[");
+          break;
+        case Reader::Token::arrayEnd:
+          tokens.emplace_back("]");
+          break;
+        case Reader::Token::key:
+          tokens.push_back("key:" + std::string(reader.text()));
+          break;
+        case Reader::Token::string:
+          tokens.push_back("s:" + std::string(reader.text()));
+          break;
+        case Reader::Token::number:
+          tokens.push_back("n:" + reader.number().toString());
+          break;
+        case Reader::Token::boolean:
+          tokens.emplace_back(reader.boolean() ? "true" : "false");
+          break;
+        case Reader::Token::null:
+          tokens.emplace_back("null");
+          break;
+        default:
+          tokens.emplace_back("?");
+      }
+    }
+  });
+}
+std::vector<std::string> tokensOf(const std::string &text)
+{
+  BufferSource source{ text };
+  return tokensOf(source);
+}
+}// namespace
+
+TEST_CASE("Check pull reader.", "[JSON][Parse][Reader]")
+{
+  SECTION("Tokens of a small document are read in document order.", "[JSON][Parse][Reader]")
+  {
+    REQUIRE(tokensOf(R"({ "x" : [1, "aA", true, false, null, {}, []], "y" : -2.5 })")
+            == std::vector<std::string>{
+              "{", "key:x", "[", "n:1", "s:aA", "true", "false", "null", "{", "}", "[", "]", "]", "key:y", "n:-2.5", "}" });
+    REQUIRE(tokensOf(" 42 ") == std::vector<std::string>{ "n:42" });
+  }
+  SECTION("Tokens match the parse events for each example file.", "[JSON][Parse][Reader]")
+  {
+    TEST_FILE_LIST(testFile);
+    const std::string text{ JSON::fromFile(prefixTestDataPath(testFile)) };
+    EventRecorder recorder;
+    JSON().parse(BufferSource{ text }, recorder);
+    REQUIRE(tokensOf(text) == recorder.events);
+    FileSource source{ prefixTestDataPath(testFile) };
+    REQUIRE(tokensOf(source) == recorder.events);
+  }
+  SECTION("Malformed input reports the same errors as a tree parse.", "[JSON][Parse][Reader]")
+  {
+    const auto text = GENERATE(values<std::string>({ R"({ "one" : "Apple })",
+      R"({ "key" 4444})",
+      R"([\"a"])",
+      R"(["abc)",
+      R"([1,2)",
+      R"([1 2])",
+      R"({"a":1)",
+      R"({"a":1 "b":2})",
+      R"([tru])",
+      R"([nul])",
+      R"([1.2.3])",
+      R"(['a'])" }));
+    const auto expected = textOrError([&](std::vector<std::string> &) { JSON().parse(BufferSource{ text }); });
+    REQUIRE_FALSE(expected.empty());
+    REQUIRE(tokensOf(text) == expected);
+  }
+  SECTION("Maximum parser depth applies to the reader.", "[JSON][Parse][Reader]")
+  {
+    BufferSource source{ "[[[1]]]" };
+    Reader reader{ source };
+    reader.setMaxParserDepth(4);
+    REQUIRE(reader.getMaxParserDepth() == 4);
+    REQUIRE(reader.next() == Reader::Token::arrayStart);
+    REQUIRE(reader.next() == Reader::Token::arrayStart);
+    REQUIRE(reader.next() == Reader::Token::arrayStart);
+    REQUIRE(reader.depth() == 3);
+    REQUIRE_THROWS_WITH(reader.next(), "JSON Syntax Error: Maximum parser depth exceeded.");
+  }
+  SECTION("Source is left after the document once it has been read.", "[JSON][Parse][Reader]")
+  {
+    BufferSource source{ "  [1, 2]  " };
+    Reader reader{ source };
+    while (reader.next() != Reader::Token::end) {}
+    REQUIRE_FALSE(source.more());
+    REQUIRE(reader.next() == Reader::Token::end);
+  }
+  SECTION("Skip passes over the values of unwanted keys.", "[JSON][Parse][Reader]")
+  {
+    BufferSource source{ R"({"a":{"b":[1,{"c":2}],"d":"e"},"f":[3],"g":4,"h":"x","i":{}})" };
+    Reader reader{ source };
+    std::vector<std::string> kept;
+    REQUIRE(reader.next() == Reader::Token::objectStart);
+    while (reader.next() == Reader::Token::key) {
+      if (reader.text() == "g") {
+        REQUIRE(reader.next() == Reader::Token::number);
+        kept.push_back(reader.number().toString());
+      } else if (reader.text() == "h") {
+        REQUIRE(reader.next() == Reader::Token::string);
+        kept.emplace_back(reader.text());
+      } else {
+        reader.skip();
+      }
+    }
+    REQUIRE(reader.token() == Reader::Token::objectEnd);
+    REQUIRE(kept == std::vector<std::string>{ "4", "x" });
+    REQUIRE(reader.next() == Reader::Token::end);
+  }
+  SECTION("Skip after an object or array start passes over the rest of it.", "[JSON][Parse][Reader]")
+  {
+    BufferSource source{ R"([[1,[2,3],4],{"a":[5]},6])" };
+    Reader reader{ source };
+    REQUIRE(reader.next() == Reader::Token::arrayStart);
+    REQUIRE(reader.next() == Reader::Token::arrayStart);
+    reader.skip();
+    REQUIRE(reader.depth() == 1);
+    REQUIRE(reader.next() == Reader::Token::objectStart);
+    reader.skip();
+    REQUIRE(reader.next() == Reader::Token::number);
+    REQUIRE(reader.number().toString() == "6");
+    REQUIRE(reader.next() == Reader::Token::arrayEnd);
+  }
+  SECTION("Skip still reports mismatched and unclosed brackets.", "[JSON][Parse][Reader]")
+  {
+    BufferSource source{ R"({"a":[1,2,}],"b":1})" };
+    Reader reader{ source };
+    REQUIRE(reader.next() == Reader::Token::objectStart);
+    REQUIRE(reader.next() == Reader::Token::key);
+    REQUIRE_THROWS_WITH(
+      reader.skip(), "JSON Syntax Error [Line: 1 Column: 11]: Missing closing ']' in array definition.");
+    BufferSource unclosed{ R"({"a":[1,"]}"  )" };
+    Reader unclosedReader{ unclosed };
+    REQUIRE(unclosedReader.next() == Reader::Token::objectStart);
+    REQUIRE(unclosedReader.next() == Reader::Token::key);
+    REQUIRE_THROWS_WITH(unclosedReader.skip(),
+      "JSON Syntax Error [Line: 1 Column: 15]: Missing closing ']' in array definition.");
+  }
+  SECTION("Skip steps over strings holding brackets and escaped quotes without decoding them.",
+    "[JSON][Parse][Reader]")
+  {
+    const std::string json{ R"({"a":{"b":"}]\"[{\uZZZZ","c":[1,"]"]},"d":"\"}","e":true})" };
+    for (const bool contiguous : { true, false }) {
+      const std::string fileName{ generateRandomFileName() };
+      JSON::toFile(fileName, json);
+      BufferSource buffer{ json };
+      FileSource file{ fileName };
+      ISource &source = contiguous ? static_cast<ISource &>(buffer) : static_cast<ISource &>(file);
+      Reader reader{ source };
+      REQUIRE(reader.next() == Reader::Token::objectStart);
+      REQUIRE(reader.next() == Reader::Token::key);
+      reader.skip();
+      REQUIRE(reader.token() == Reader::Token::objectEnd);
+      REQUIRE(reader.next() == Reader::Token::key);
+      reader.skip();
+      REQUIRE(reader.token() == Reader::Token::none);
+      REQUIRE(reader.next() == Reader::Token::key);
+      REQUIRE(reader.text() == "e");
+      REQUIRE(reader.next() == Reader::Token::boolean);
+      REQUIRE(reader.next() == Reader::Token::objectEnd);
+      REQUIRE(reader.next() == Reader::Token::end);
+      file.close();
+      std::filesystem::remove(fileName);
+    }
+  }
+  SECTION("Skip counts nesting against the maximum depth.", "[JSON][Parse][Reader]")
+  {
+    BufferSource source{ R"({"a":[[[[1]]]]})" };
+    Reader reader{ source };
+    reader.setMaxParserDepth(4);
+    REQUIRE(reader.next() == Reader::Token::objectStart);
+    REQUIRE(reader.next() == Reader::Token::key);
+    REQUIRE_THROWS_WITH(reader.skip(), "JSON Syntax Error: Maximum parser depth exceeded.");
+  }
+  SECTION("Value parses just the next value into a Node.", "[JSON][Parse][Reader]")
+  {
+    BufferSource source{ R"({"skip":[1,2],"records":[{"id":1},{"id":2,"tags":["x"]}],"n":3})" };
+    Reader reader{ source };
+    REQUIRE(reader.next() == Reader::Token::objectStart);
+    REQUIRE(reader.next() == Reader::Token::key);
+    reader.skip();
+    REQUIRE(reader.next() == Reader::Token::key);
+    REQUIRE(reader.next() == Reader::Token::arrayStart);
+    std::vector<std::string> records;
+    for (Node record = reader.value(); !record.isEmpty(); record = reader.value()) {
+      records.push_back(nodeText(record));
+    }
+    REQUIRE(records == std::vector<std::string>{ R"({"id":1})", R"({"id":2,"tags":["x"]})" });
+    REQUIRE(reader.next() == Reader::Token::arrayEnd);
+    REQUIRE(reader.next() == Reader::Token::key);
+    REQUIRE(reader.text() == "n");
+    const Node n = reader.value();
+    REQUIRE(NRef<Number>(n).value<int>() == 3);
+    REQUIRE(reader.value().isEmpty());
+    REQUIRE(reader.next() == Reader::Token::objectEnd);
+    REQUIRE(reader.next() == Reader::Token::end);
+  }
+  SECTION("Value of the root parses the whole document.", "[JSON][Parse][Reader]")
+  {
+    BufferSource source{ R"( {"a":[1,2]} )" };
+    Reader reader{ source };
+    const Node root = reader.value();
+    REQUIRE(NRef<Number>(root["a"][1]).value<int>() == 2);
+    REQUIRE(reader.next() == Reader::Token::end);
+    REQUIRE_FALSE(source.more());
+  }
+  SECTION("Value counts the objects/arrays already open towards the depth limit.", "[JSON][Parse][Reader]")
+  {
+    BufferSource source{ R"([[[1]],[[[2]]]])" };
+    Reader reader{ source };
+    reader.setMaxParserDepth(5);
+    REQUIRE(reader.next() == Reader::Token::arrayStart);
+    REQUIRE_NOTHROW(reader.value());
+    REQUIRE_THROWS_WITH(reader.value(), "JSON Syntax Error: Maximum parser depth exceeded.");
+    REQUIRE(reader.getMaxParserDepth() == 5);
+  }
+  SECTION("Value errors report the same position as a tree parse.", "[JSON][Parse][Reader]")
+  {
+    BufferSource source{ "[1,\n {\"a\" 2}]" };
+    Reader reader{ source };
+    REQUIRE(reader.next() == Reader::Token::arrayStart);
+    REQUIRE(reader.next() == Reader::Token::number);
+    REQUIRE_THROWS_WITH(reader.value(), "JSON Syntax Error [Line: 2 Column: 8]: Missing ':' in key value pair.");
+  }
+}
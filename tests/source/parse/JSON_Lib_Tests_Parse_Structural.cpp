@@ -0,0 +1,146 @@
+#include "JSON_Lib_Tests.hpp"
+
+namespace {
+using Kernel = Structural_Parser::Kernel;
+// Parse text with the structural parser using a given kernel, returning stringified result or error text.
+std::string structuralParse(const std::string &text, const Kernel kernel, std::pair<long, long> *position = nullptr)
+{
+  auto parser = std::make_unique<Structural_Parser>(std::make_unique<Default_Translator>(), kernel);
+  JSON json{ nullptr, std::move(parser) };
+  BufferSource source{ text };
+  std::string result;
+  try {
+    json.parse(source);
+    result = json.stringifyToString();
+  } catch (const std::exception &ex) {
+    result = ex.what();
+  }
+  if (position != nullptr) { *position = source.getPosition(); }
+  return result;
+}
+// Same for the default parser.
+std::string defaultParse(const std::string &text, std::pair<long, long> *position = nullptr)
+{
+  JSON json;
+  BufferSource source{ text };
+  std::string result;
+  try {
+    json.parse(source);
+    result = json.stringifyToString();
+  } catch (const std::exception &ex) {
+    result = ex.what();
+  }
+  if (position != nullptr) { *position = source.getPosition(); }
+  return result;
+}
+}// namespace
+
+TEST_CASE("Check structural parser kernel selection.", "[JSON][Parse][Structural]")
+{
+  SECTION("Scalar and automatic kernels are always supported.", "[JSON][Parse][Structural]")
+  {
+    REQUIRE(Structural_Parser::isKernelSupported(Kernel::scalar));
+    REQUIRE(Structural_Parser::isKernelSupported(Kernel::automatic));
+  }
+  SECTION("Automatic selects a concrete supported kernel.", "[JSON][Parse][Structural]")
+  {
+    const Structural_Parser parser;
+    REQUIRE(parser.getKernel() != Kernel::automatic);
+    REQUIRE(Structural_Parser::isKernelSupported(parser.getKernel()));
+  }
+  SECTION("Scalar kernel can be forced.", "[JSON][Parse][Structural]")
+  {
+    Structural_Parser parser;
+    parser.setKernel(Kernel::scalar);
+    REQUIRE(parser.getKernel() == Kernel::scalar);
+  }
+}
+TEST_CASE("Check structural parser matches default parser on example files.", "[JSON][Parse][Structural]")
+{
+  TEST_FILE_LIST(testFile);
+  const auto kernel = GENERATE(Kernel::scalar, Kernel::sse2, Kernel::avx2);
+  const std::string text{ JSON::fromFile(prefixTestDataPath(testFile)) };
+  std::pair<long, long> structuralPosition;
+  std::pair<long, long> defaultPosition;
+  REQUIRE(structuralParse(text, kernel, &structuralPosition) == defaultParse(text, &defaultPosition));
+  REQUIRE(structuralPosition == defaultPosition);
+}
+TEST_CASE("Check structural parser matches default parser on awkward input.", "[JSON][Parse][Structural]")
+{
+  const auto kernel = GENERATE(Kernel::scalar, Kernel::sse2, Kernel::avx2);
+  SECTION("Strings and escapes crossing 64 byte block boundaries.", "[JSON][Parse][Structural]")
+  {
+    for (std::size_t padding = 0; padding < 70; padding++) {
+      for (const std::string tail : { R"(\\")", R"(\"x")", R"(\\\"y")", R"(A")", R"(\q")", R"(")" }) {
+        const std::string text{ "[\"" + std::string(padding, 'a') + tail + ", [true,false , null], {\"k\":-1.5e3}]" };
+        REQUIRE(structuralParse(text, kernel) == defaultParse(text));
+      }
+    }
+  }
+  SECTION("Scalars and structurals crossing 64 byte block boundaries.", "[JSON][Parse][Structural]")
+  {
+    for (std::size_t padding = 0; padding < 70; padding++) {
+      const std::string text{ std::string(padding, ' ') + "{\"n\":123456789,\"t\":true,\"a\":[ 1 ,\t2\r\n,3 ]}  " };
+      std::pair<long, long> structuralPosition;
+      std::pair<long, long> defaultPosition;
+      REQUIRE(structuralParse(text, kernel, &structuralPosition) == defaultParse(text, &defaultPosition));
+      REQUIRE(structuralPosition == defaultPosition);
+    }
+  }
+  SECTION("Malformed input reports the same error and position.", "[JSON][Parse][Structural]")
+  {
+    const auto text = GENERATE(values<std::string>({ R"({ "one" : "Apple })",
+      "{\n\"key\" : trrue }",
+      "[1,\n2,\n  nul ]",
+      R"({ "one" : 18987u3 })",
+      "{\n  \"one\" : 1\n  \"two\" : 2 }",
+      "[1,2,3,]",
+      R"({ "key" 4444})",
+      "[1,2,3,4,5,6",
+      R"({ "a" : 1, "a" : 2 })",
+      R"(["\u00"])",
+      R"([\"a"])",
+      "[truex]",
+      "[1:2]",
+      "{'a':1}" }));
+    std::pair<long, long> structuralPosition;
+    std::pair<long, long> defaultPosition;
+    REQUIRE(structuralParse(text, kernel, &structuralPosition) == defaultParse(text, &defaultPosition));
+    REQUIRE(structuralPosition == defaultPosition);
+  }
+  SECTION("parseResult reports the same status, message and position.", "[JSON][Parse][Structural][Result]")
+  {
+    const auto text = GENERATE(values<std::string>(
+      { R"({ "one" : "Apple })", "[1,2,3,]", R"({ "a" : 1, "a" : 2 })", R"(["\uZZZZ"])", "[1,\n2,\n  nul ]", "[1,2]" }));
+    JSON structural{ nullptr, std::make_unique<Structural_Parser>(std::make_unique<Default_Translator>(), kernel) };
+    BufferSource structuralSource{ text };
+    const auto structuralResult = structural.parseResult(structuralSource);
+    BufferSource defaultSource{ text };
+    const auto defaultResult = JSON().parseResult(defaultSource);
+    REQUIRE(structuralResult.status == defaultResult.status);
+    REQUIRE(structuralResult.message.str() == defaultResult.message.str());
+    REQUIRE(structuralResult.position == defaultResult.position);
+    REQUIRE(structuralSource.getPosition() == defaultSource.getPosition());
+  }
+  SECTION("Trailing input after the root value is left unread.", "[JSON][Parse][Structural]")
+  {
+    const auto text = GENERATE(values<std::string>({ "[1] x", "true: 1", "1:", "\"a\" \"b", "{} {\"x\":\"" }));
+    std::pair<long, long> structuralPosition;
+    std::pair<long, long> defaultPosition;
+    REQUIRE(structuralParse(text, kernel, &structuralPosition) == defaultParse(text, &defaultPosition));
+    REQUIRE(structuralPosition == defaultPosition);
+  }
+  SECTION("Parser depth limit is the same.", "[JSON][Parse][Structural]")
+  {
+    const auto depth = GENERATE(127, 128);
+    const std::string text{ std::string(depth, '[') + std::string(depth, ']') };
+    REQUIRE(structuralParse(text, kernel) == defaultParse(text));
+  }
+}
+TEST_CASE("Check structural parser falls back for non-contiguous sources.", "[JSON][Parse][Structural]")
+{
+  JSON json{ nullptr, std::make_unique<Structural_Parser>() };
+  FileSource source{ prefixTestDataPath(kSingleJSONFile) };
+  REQUIRE_NOTHROW(json.parse(source));
+  REQUIRE(isA<Object>(json.root()));
+}
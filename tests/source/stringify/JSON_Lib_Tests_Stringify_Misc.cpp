@@ -1,5 +1,35 @@
 #include "JSON_Lib_Tests.hpp"
 
+#include "YAML_Stringify.hpp"
+
+// Buffer destination that also counts the add() calls made on it
+class CountingDestination final : public DestinationBase
+{
+public:
+  void add(const std::string &bytes) override { add(std::string_view(bytes)); }
+  void add(const char *bytes) override { add(std::string_view(bytes)); }
+  void add(const std::string_view &bytes) override
+  {
+    buffer += bytes;
+    calls++;
+    if (!bytes.empty()) { trackLast(bytes.back()); }
+  }
+  void add(const char ch) override
+  {
+    buffer += ch;
+    calls++;
+    trackLast(ch);
+  }
+  void clear() override
+  {
+    buffer.clear();
+    calls = 0;
+    trackLast(0);
+  }
+  std::string buffer;
+  std::size_t calls{};
+};
+
 TEST_CASE("Check JSON stringification of a list of example JSON files.", "[JSON][Stringify]")
 {
   JSON json;
@@ -67,3 +97,63 @@ TEST_CASE("Check JSON stringification of a list of example JSON files.", "[JSON]
     REQUIRE(result.back() != ' ');
   }
 }
+
+TEST_CASE("Check stringify output is passed to the destination in blocks.", "[JSON][Stringify][Buffered]")
+{
+  SECTION("Compact array of many small values is written in a few large adds.", "[JSON][Stringify][Buffered]")
+  {
+    std::string expected{ "[" };
+    for (int index = 0; index < 20000; index++) {
+      if (index > 0) { expected += ','; }
+      expected += std::to_string(index % 10);
+    }
+    expected += ']';
+    JSON json;
+    json.parse(BufferSource{ expected });
+    CountingDestination destination;
+    json.stringify(destination);
+    REQUIRE(destination.buffer == expected);
+    REQUIRE(destination.calls <= expected.size() / StringifyBuffer::kBlockSize + 1);
+  }
+  SECTION("Pretty print larger than a block is unchanged.", "[JSON][Stringify][Buffered]")
+  {
+    std::string expected{ "[\n" };
+    for (int index = 0; index < 5000; index++) {
+      if (index > 0) { expected += ",\n"; }
+      expected += "    {\n        \"key\": \"value\"\n    }";
+    }
+    expected += "\n]";
+    JSON json;
+    json.parse(BufferSource{ expected });
+    CountingDestination destination;
+    json.print(destination);
+    REQUIRE(destination.buffer == expected);
+  }
+  SECTION("YAML indentation is correct across block boundaries.", "[JSON][Stringify][Buffered][YAML]")
+  {
+    std::string source{ "{" };
+    std::string expected{ "---\n" };
+    for (int index = 0; index < 2000; index++) {
+      if (index > 0) { source += ','; }
+      source += "\"k" + std::to_string(index) + "\":[1,{\"a\":true}]";
+      expected += "\"k" + std::to_string(index) + "\": \n  - 1\n  - \"a\": true\n";
+    }
+    source += '}';
+    expected += "...\n";
+    JSON json(makeStringify<YAML_Stringify>());
+    json.parse(BufferSource{ source });
+    CountingDestination destination;
+    json.stringify(destination);
+    REQUIRE(destination.buffer == expected);
+  }
+  SECTION("Strings larger than a block are written straight through.", "[JSON][Stringify][Buffered]")
+  {
+    const std::string large(StringifyBuffer::kBlockSize * 2, 'x');
+    JSON json;
+    json.parse(BufferSource{ "[\"" + large + "\",1]" });
+    CountingDestination destination;
+    json.stringify(destination);
+    REQUIRE(destination.buffer == "[\"" + large + "\",1]");
+    REQUIRE(destination.calls == 3);
+  }
+}
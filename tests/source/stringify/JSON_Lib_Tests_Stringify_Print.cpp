@@ -161,6 +161,53 @@ TEST_CASE("Check Check printing of JSON to a buffer.", "[JSON][Print][Buffer]")
     json.print(jsonDestination);
     REQUIRE(jsonDestination.toString() == expected);
   }
+  SECTION("Print an object indented with tabs.", "[JSON][Print][Object][Buffer][Indent]")
+  {
+    json.setIndent(1);
+    json.setIndentCharacter('\t');
+    REQUIRE(json.getIndentCharacter() == '\t');
+    BufferDestination jsonDestination;
+    json.parse(BufferSource{ R"({"a":[1,{"b":null}],"c":{}})" });
+    json.print(jsonDestination);
+    REQUIRE(jsonDestination.toString() == "{\n\t\"a\": [\n\t\t1,\n\t\t{\n\t\t\t\"b\": null\n\t\t}\n\t],\n\t\"c\": {\n\n\t}\n}");
+  }
+  SECTION("Print nesting deeper than the cached indent levels and wider than the indent block.",
+    "[JSON][Print][Array][Buffer][Indent]")
+  {
+    for (const long indent : { 3L, 100L }) {
+      constexpr int kDepth = 40;
+      std::string compact;
+      std::string expected;
+      for (int level = 0; level < kDepth; level++) {
+        compact += "[";
+        expected += "[\n" + std::string(static_cast<std::size_t>(indent * (level + 1)), ' ');
+      }
+      compact += "1";
+      expected += "1";
+      for (int level = kDepth - 1; level >= 0; level--) {
+        compact += "]";
+        expected += "\n" + std::string(static_cast<std::size_t>(indent * level), ' ') + "]";
+      }
+      json.setIndent(indent);
+      BufferDestination jsonDestination;
+      json.parse(BufferSource{ compact });
+      json.print(jsonDestination);
+      REQUIRE(jsonDestination.toString() == expected);
+    }
+  }
+  SECTION("Set an invalid print indent character.", "[JSON][Print][Indent][Exception]")
+  {
+    REQUIRE_THROWS_WITH(json.setIndentCharacter('x'), "JSON Error: Invalid print indentation character.");
+    REQUIRE(json.getIndentCharacter() == ' ');
+  }
+  SECTION("Set a very large print indent and print a primitive.", "[JSON][Print][Indent]")
+  {
+    REQUIRE_NOTHROW(json.setIndent(std::numeric_limits<long>::max()));
+    BufferDestination jsonDestination;
+    json.parse(BufferSource{ "42" });
+    json.print(jsonDestination);
+    REQUIRE(jsonDestination.toString() == "42");
+  }
   SECTION("Print idempotency: re-parse printed output and re-print gives same result.", "[JSON][Print][Buffer]")
   {
     json.setIndent(4);